@@ -170,6 +170,9 @@ EqualizerExampleAudioProcessor::EqualizerExampleAudioProcessor()
     // MAGIC GUI: add a meter at the output
     outputMeter = magicState.createAndAddObject<foleys::MagicLevelSource>("outputMeter");
 
+    // MAGIC GUI: skip the analysis while no editor displays it
+    magicState.setVisualisersIdleWithoutConsumers (true);
+
     for (auto* parameter : getParameters())
         if (auto* p = dynamic_cast<juce::AudioProcessorParameterWithID*>(parameter))
             treeState.addParameterListener (p->paramID, this);
@@ -178,8 +181,8 @@ EqualizerExampleAudioProcessor::EqualizerExampleAudioProcessor()
     magicState.getPropertyAsValue ("analyser:input").setValue (true);
     magicState.getPropertyAsValue ("analyser:output").setValue (true);
 
-    inputAnalysing.attachToValue (magicState.getPropertyAsValue ("analyser:input"));
-    outputAnalysing.attachToValue (magicState.getPropertyAsValue ("analyser:output"));
+    inputAnalysing  = magicState.bindProperty<bool> ("analyser:input");
+    outputAnalysing = magicState.bindProperty<bool> ("analyser:output");
 }
 
 EqualizerExampleAudioProcessor::~EqualizerExampleAudioProcessor()
@@ -248,8 +251,11 @@ void EqualizerExampleAudioProcessor::processBlock (juce::AudioBuffer<float>& buf
 
     filter.get<6>().setGainLinear (gain);
 
+    // GUI MAGIC: read the GUI switches lock-free
+    const auto& bridge = magicState.getPropertyBridge();
+
     // GUI MAGIC: measure before processing
-    if (inputAnalysing.get())
+    if (bridge.get (inputAnalysing))
         inputAnalyser->pushSamples (buffer);
 
     juce::dsp::AudioBlock<float>              ioBuffer (buffer);
@@ -257,7 +263,7 @@ void EqualizerExampleAudioProcessor::processBlock (juce::AudioBuffer<float>& buf
     filter.process (context);
 
     // GUI MAGIC: measure after processing
-    if (outputAnalysing.get())
+    if (bridge.get (outputAnalysing))
         outputAnalyser->pushSamples (buffer);
 
     outputMeter->pushSamples (buffer);
@@ -403,14 +409,6 @@ juce::ValueTree EqualizerExampleAudioProcessor::createGuiValueTree()
     return juce::ValueTree::fromXml (text);
 }
 
-void EqualizerExampleAudioProcessor::postSetStateInformation()
-{
-    // MAGIC GUI: let the magicState conveniently handle save and restore the state.
-    //            You don't need to use that, but it also takes care of restoring the last editor size
-    inputAnalysing.attachToValue (magicState.getPropertyAsValue ("analyser:input"));
-    outputAnalysing.attachToValue (magicState.getPropertyAsValue ("analyser:output"));
-}
-
 //==============================================================================
 const juce::String EqualizerExampleAudioProcessor::getName() const
 {
@@ -116,8 +116,6 @@ public:
      */
     juce::ValueTree createGuiValueTree() override;
 
-    void postSetStateInformation() override;
-
     //==============================================================================
     const juce::String getName() const override;
 
@@ -152,8 +150,8 @@ private:
     foleys::MagicFilterPlot*  plotSum = nullptr;
     foleys::MagicLevelSource* outputMeter = nullptr;
 
-    foleys::AtomicValueAttachment<bool> inputAnalysing;
-    foleys::AtomicValueAttachment<bool> outputAnalysing;
+    foleys::PropertyBridge::Handle<bool> inputAnalysing;
+    foleys::PropertyBridge::Handle<bool> outputAnalysing;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EqualizerExampleAudioProcessor)
 };
@@ -0,0 +1,129 @@
+/*
+ ==============================================================================
+    Copyright (c) 2022 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    License for non-commercial projects:
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+    License for commercial products:
+
+    To sell commercial products containing this module, you are required to buy a
+    License from https://foleysfinest.com/developer/pluginguimagic/
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include <foleys_gui_magic/foleys_gui_magic.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+thread_local bool countAllocations = false;
+thread_local int  numAllocations   = 0;
+
+struct ScopedAllocationCounter
+{
+    ScopedAllocationCounter()  { numAllocations = 0; countAllocations = true; }
+    ~ScopedAllocationCounter() { countAllocations = false; }
+
+    int getNumAllocations() const { return numAllocations; }
+};
+}
+
+// this replaces operator new for the whole binary, that's why these tests are built into a runner of their own
+void* operator new (std::size_t size)
+{
+    if (countAllocations)
+        ++numAllocations;
+
+    if (auto* pointer = std::malloc (size == 0 ? 1 : size))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void operator delete (void* pointer) noexcept
+{
+    std::free (pointer);
+}
+
+void operator delete (void* pointer, std::size_t) noexcept
+{
+    std::free (pointer);
+}
+
+TEST_CASE ("Plot paths don't allocate in the steady state", "[visualiser]")
+{
+    const auto bounds = juce::Rectangle<float> (0.0f, 0.0f, 400.0f, 200.0f);
+
+    foleys::MagicPlotComponent component;
+    juce::Path path, filledPath;
+
+    auto warmUpAndCount = [&](foleys::MagicPlotSource& source)
+    {
+        source.createPlotPaths (path, filledPath, bounds, component);
+        source.createPlotPaths (path, filledPath, bounds, component);
+
+        ScopedAllocationCounter counter;
+        source.createPlotPaths (path, filledPath, bounds, component);
+        return counter.getNumAllocations();
+    };
+
+    juce::AudioBuffer<float> buffer (1, 512);
+    for (int i = 0; i < buffer.getNumSamples(); ++i)
+        buffer.setSample (0, i, std::sin (i * 0.1f));
+
+    SECTION ("Oscilloscope")
+    {
+        foleys::MagicOscilloscope oscilloscope;
+        oscilloscope.prepareToPlay (48000.0, 512);
+        component.setPlotSource (&oscilloscope);
+
+        for (int i = 0; i < 10; ++i)
+            oscilloscope.pushSamples (buffer);
+
+        REQUIRE (warmUpAndCount (oscilloscope) == 0);
+        component.setPlotSource (nullptr);
+    }
+
+    SECTION ("Analyser")
+    {
+        foleys::MagicAnalyser analyser;
+        analyser.prepareToPlay (48000.0, 512);
+
+        REQUIRE (warmUpAndCount (analyser) == 0);
+    }
+
+    SECTION ("FilterPlot")
+    {
+        foleys::MagicFilterPlot filterPlot;
+        filterPlot.prepareToPlay (48000.0, 512);
+        filterPlot.setIIRCoefficients (juce::dsp::IIR::Coefficients<float>::makePeakFilter (48000.0, 1000.0f, 1.0f, 2.0f), 24.0f);
+
+        REQUIRE (warmUpAndCount (filterPlot) == 0);
+    }
+}
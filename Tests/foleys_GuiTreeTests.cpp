@@ -36,6 +36,11 @@
 
 #include <foleys_gui_magic/foleys_gui_magic.h>
 #include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
+#include <foleys_gui_magic/Editor/foleys_GUITreeEditor.h>
+#endif
 
 
 #include "foleys_TestProcessors.h"
@@ -46,3 +51,614 @@ std::unique_ptr<juce::AudioProcessor> processor (new UnitTestProcessor());
 std::unique_ptr<juce::AudioProcessorEditor> editor (processor->createEditor());
 REQUIRE (editor.get() != nullptr);
 }
+
+TEST_CASE ("Factory metadata", "[gui]")
+{
+    UnitTestProcessor processor;
+    foleys::MagicGUIBuilder builder (processor.getMagicState());
+    builder.registerJUCEFactories();
+
+    juce::ValueTree node (foleys::IDs::slider);
+    auto item = builder.createGuiItem (node);
+    REQUIRE (item != nullptr);
+
+    REQUIRE (builder.getColourNames (foleys::IDs::slider) == item->getColourNames());
+    REQUIRE (builder.getSettableProperties (foleys::IDs::slider, node).size() == item->getSettableProperties().size());
+    REQUIRE (builder.getColourNames (foleys::IDs::plot).contains ("plot-color"));
+}
+
+TEST_CASE ("GuiItem lookup", "[gui]")
+{
+    UnitTestProcessor processor;
+    std::unique_ptr<juce::AudioProcessorEditor> editor (processor.createEditor());
+    auto* magicEditor = dynamic_cast<foleys::MagicPluginEditor*> (editor.get());
+    REQUIRE (magicEditor != nullptr);
+
+    auto& builder = magicEditor->getGUIBuilder();
+
+    juce::ValueTree view (foleys::IDs::view);
+    for (int i = 0; i < 3; ++i)
+        view.appendChild (juce::ValueTree (foleys::IDs::slider), nullptr);
+
+    juce::ValueTree named (foleys::IDs::slider, { { foleys::IDs::id, "gain" } });
+    view.appendChild (named, nullptr);
+    builder.getGuiRootNode().appendChild (view, nullptr);
+
+    REQUIRE (builder.findGuiItem (view) != nullptr);
+
+    // unnamed nodes of the same type are told apart
+    for (int i = 0; i < 3; ++i)
+    {
+        auto* item = builder.findGuiItem (view.getChild (i));
+        REQUIRE (item != nullptr);
+        REQUIRE (item->getNode() == view.getChild (i));
+    }
+
+    auto* gain = builder.findGuiItem (named);
+    REQUIRE (gain != nullptr);
+    REQUIRE (builder.findGuiItemWithId ("gain") == gain);
+
+    named.setProperty (foleys::IDs::id, "level", nullptr);
+    REQUIRE (builder.findGuiItemWithId ("gain") == nullptr);
+    REQUIRE (builder.findGuiItemWithId ("level") == gain);
+    REQUIRE (builder.findGuiItem (named) == gain);
+
+    view.removeChild (named, nullptr);
+    REQUIRE (builder.findGuiItem (named) == nullptr);
+    REQUIRE (builder.findGuiItemWithId ("level") == nullptr);
+}
+
+TEST_CASE ("Saved positions", "[gui]")
+{
+    UnitTestProcessor processor;
+    std::unique_ptr<juce::AudioProcessorEditor> editor (processor.createEditor());
+    auto* magicEditor = dynamic_cast<foleys::MagicPluginEditor*> (editor.get());
+    REQUIRE (magicEditor != nullptr);
+
+    auto& builder = magicEditor->getGUIBuilder();
+
+    juce::ValueTree view (foleys::IDs::view, { { foleys::IDs::display, foleys::IDs::contents } });
+    juce::ValueTree child (foleys::IDs::slider, { { foleys::IDs::posX, "10%" },
+                                                  { foleys::IDs::posY, 20 },
+                                                  { foleys::IDs::posWidth, "50%" },
+                                                  { foleys::IDs::posHeight, "25%" } });
+    view.appendChild (child, nullptr);
+    builder.getGuiRootNode().appendChild (view, nullptr);
+
+    auto* container = builder.findGuiItem (view);
+    REQUIRE (container != nullptr);
+    container->setBounds (0, 0, 301, 307);
+
+    auto* item = builder.findGuiItem (child);
+    REQUIRE (item != nullptr);
+
+    // a third of the width can't be written with two decimals without moving by a pixel
+    const auto client = container->getClientBounds();
+    const auto moved  = juce::Rectangle<int> (client.getX() + client.getWidth() / 3, client.getY() + 37, 117, 91);
+    item->setBounds (moved);
+    item->savePosition();
+
+    REQUIRE (child.getProperty (foleys::IDs::posX).toString().endsWith ("%"));
+    REQUIRE (child.getProperty (foleys::IDs::posY).isInt());
+    REQUIRE (child.getProperty (foleys::IDs::posHeight).toString().endsWith ("%"));
+
+    SECTION ("The saved position is laid out unchanged")
+    {
+        container->updateLayout();
+        REQUIRE (item->getBounds() == moved);
+    }
+
+    SECTION ("The saved position survives saving and loading the XML")
+    {
+        auto loaded = juce::ValueTree::fromXml (child.toXmlString());
+        view.removeChild (child, nullptr);
+        view.appendChild (loaded, nullptr);
+
+        auto* loadedItem = builder.findGuiItem (loaded);
+        REQUIRE (loadedItem != nullptr);
+
+        container->updateLayout();
+        REQUIRE (loadedItem->getBounds() == moved);
+    }
+}
+
+#if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
+TEST_CASE ("GUI tree editor updates", "[gui]")
+{
+    UnitTestProcessor processor;
+    foleys::MagicGUIBuilder builder (processor.getMagicState());
+
+    juce::ValueTree view (foleys::IDs::view);
+    for (auto id : { "a", "b", "c" })
+        view.appendChild (juce::ValueTree (foleys::IDs::view, { { foleys::IDs::id, id } }), nullptr);
+
+    auto b = view.getChild (1);
+    b.appendChild (juce::ValueTree (foleys::IDs::slider), nullptr);
+
+    foleys::GUITreeEditor editor (builder);
+    editor.setValueTree (view);
+
+    auto* treeView = dynamic_cast<juce::TreeView*> (editor.getChildComponent (0));
+    REQUIRE (treeView != nullptr);
+
+    auto* rootItem = treeView->getRootItem();
+    editor.setSelectedNode (b);
+    REQUIRE (rootItem->getNumSubItems() == 3);
+
+    // the items are updated in place, so selection and openness survive
+    auto* itemB = rootItem->getSubItem (1);
+    itemB->setOpen (true);
+    REQUIRE (itemB->isSelected());
+    REQUIRE (itemB->getNumSubItems() == 1);
+
+    auto isKept = [&] (int index)
+    {
+        return rootItem->getSubItem (index) == itemB && itemB->isSelected() && itemB->isOpen();
+    };
+
+    SECTION ("Add")
+    {
+        view.addChild (juce::ValueTree (foleys::IDs::slider), 0, nullptr);
+        REQUIRE (rootItem->getNumSubItems() == 4);
+        REQUIRE (isKept (2));
+
+        b.appendChild (juce::ValueTree (foleys::IDs::label), nullptr);
+        REQUIRE (itemB->getNumSubItems() == 2);
+    }
+
+    SECTION ("Remove")
+    {
+        view.removeChild (0, nullptr);
+        REQUIRE (rootItem->getNumSubItems() == 2);
+        REQUIRE (isKept (0));
+
+        b.removeChild (0, nullptr);
+        REQUIRE (itemB->getNumSubItems() == 0);
+    }
+
+    SECTION ("Reorder")
+    {
+        view.moveChild (1, 2, nullptr);
+        REQUIRE (rootItem->getNumSubItems() == 3);
+        REQUIRE (isKept (2));
+
+        view.moveChild (0, 1, nullptr);
+        REQUIRE (isKept (2));
+        REQUIRE (rootItem->getSubItem (0) != itemB);
+    }
+}
+#endif
+
+TEST_CASE ("Resolved styles", "[gui]")
+{
+    UnitTestProcessor processor;
+    foleys::MagicGUIBuilder builder (processor.getMagicState());
+    builder.registerJUCEFactories();
+
+    auto& stylesheet = builder.getStylesheet();
+    stylesheet.setStyle (foleys::DefaultGuiTrees::createDefaultStylesheet());
+
+    // nodes, that only differ in their property values, need to be told apart
+    juce::ValueTree tree (foleys::IDs::view);
+    for (int group = 0; group < 10; ++group)
+    {
+        juce::ValueTree view (foleys::IDs::view, { { foleys::IDs::styleClass, group % 2 == 0 ? "plot-view" : "" } });
+        for (int i = 0; i < 25; ++i)
+            view.appendChild (juce::ValueTree (foleys::IDs::slider, { { foleys::IDs::caption, juce::String (group * 25 + i) },
+                                                                      { foleys::IDs::margin, i } }), nullptr);
+
+        tree.appendChild (view, nullptr);
+    }
+
+    juce::ThreadPool pool (2);
+    foleys::ResolvedStyles resolved;
+    resolved.resolve (stylesheet, tree, {}, pool);
+
+    int numNodes = 0;
+    std::function<void (const juce::ValueTree&)> check = [&] (const juce::ValueTree& node)
+    {
+        ++numNodes;
+        for (const auto& name : foleys::ResolvedStyles::getCommonProperties())
+        {
+            const auto* value = resolved.find (name, node);
+            REQUIRE (value != nullptr);
+            REQUIRE (*value == stylesheet.getStyleProperty (name, node));
+        }
+
+        for (const auto& child : node)
+            check (child);
+    };
+
+    check (tree);
+    REQUIRE (numNodes > 200);
+
+    // a node that looks alike, but wasn't resolved, is looked up in the stylesheet
+    REQUIRE (resolved.find (foleys::IDs::margin, tree.getChild (0).getChild (0).createCopy()) == nullptr);
+}
+
+TEST_CASE ("Shared LookAndFeels", "[gui]")
+{
+    UnitTestProcessor processor;
+    foleys::MagicGUIBuilder builder1 (processor.getMagicState());
+    foleys::MagicGUIBuilder builder2 (processor.getMagicState());
+    builder1.registerJUCELookAndFeels();
+    builder2.registerJUCELookAndFeels();
+
+    juce::ValueTree node (foleys::IDs::slider, { { foleys::IDs::lookAndFeel, "Skeuomorphic" } });
+    auto* lookAndFeel = builder1.getStylesheet().getLookAndFeel (node);
+    REQUIRE (lookAndFeel != nullptr);
+    REQUIRE (builder2.getStylesheet().getLookAndFeel (node) == lookAndFeel);
+
+    SECTION ("Tooltip colours stay with their editor")
+    {
+        auto findTooltip = [] (juce::AudioProcessorEditor& editor) -> juce::TooltipWindow*
+        {
+            auto& builder = dynamic_cast<foleys::MagicPluginEditor&> (editor).getGUIBuilder();
+            if (auto* root = builder.findGuiItem (builder.getGuiRootNode()))
+                for (auto* child : root->getChildren())
+                    if (auto* tooltip = dynamic_cast<juce::TooltipWindow*> (child))
+                        return tooltip;
+
+            return nullptr;
+        };
+
+        UnitTestProcessor red, plain;
+        std::unique_ptr<juce::AudioProcessorEditor> redEditor (red.createEditor());
+        std::unique_ptr<juce::AudioProcessorEditor> plainEditor (plain.createEditor());
+
+        auto& redBuilder = dynamic_cast<foleys::MagicPluginEditor&> (*redEditor).getGUIBuilder();
+        redBuilder.getGuiRootNode().setProperty (foleys::IDs::tooltipBackground, "red", nullptr);
+
+        auto* redTooltip   = findTooltip (*redEditor);
+        auto* plainTooltip = findTooltip (*plainEditor);
+        REQUIRE (redTooltip != nullptr);
+        REQUIRE (plainTooltip != nullptr);
+
+        REQUIRE (redTooltip->findColour (juce::TooltipWindow::backgroundColourId) == juce::Colours::red);
+        REQUIRE (plainTooltip->findColour (juce::TooltipWindow::backgroundColourId) != juce::Colours::red);
+        REQUIRE (plainTooltip->getParentComponent()->findColour (juce::TooltipWindow::backgroundColourId) != juce::Colours::red);
+
+        // the colour is painted with the root's LookAndFeel, which is left unchanged
+        redTooltip->setSize (40, 20);
+        juce::Image image (juce::Image::ARGB, 40, 20, true);
+        juce::Graphics g (image);
+        redTooltip->paintEntireComponent (g, false);
+
+        REQUIRE (image.getPixelAt (20, 10) == juce::Colours::red);
+        REQUIRE (redTooltip->getLookAndFeel().findColour (juce::TooltipWindow::backgroundColourId) != juce::Colours::red);
+    }
+
+    SECTION ("Registered LookAndFeels are owned per builder")
+    {
+        builder1.registerLookAndFeel ("Custom", std::make_unique<juce::LookAndFeel_V4>());
+        builder2.registerLookAndFeel ("Custom", std::make_unique<juce::LookAndFeel_V4>());
+
+        juce::ValueTree custom (foleys::IDs::slider, { { foleys::IDs::lookAndFeel, "Custom" } });
+        auto* custom1 = builder1.getStylesheet().getLookAndFeel (custom);
+        REQUIRE (custom1 != nullptr);
+        REQUIRE (builder2.getStylesheet().getLookAndFeel (custom) != custom1);
+    }
+}
+
+TEST_CASE ("Decorator background cache", "[gui]")
+{
+    UnitTestProcessor processor;
+    foleys::MagicGUIBuilder builder (processor.getMagicState());
+
+    juce::ValueTree node (foleys::IDs::view, { { foleys::IDs::cacheBackground, true },
+                                               { foleys::IDs::backgroundColour, "red" } });
+
+    foleys::Decorator decorator;
+    decorator.configure (builder, node);
+    decorator.updateColours (builder, node);
+
+    juce::LookAndFeel_V4 lookAndFeel;
+    juce::Image canvas (juce::Image::ARGB, 400, 400, true);
+
+    // the returned images are kept, so a new cache can't reuse the memory of the old one
+    auto draw = [&] (juce::Rectangle<int> bounds, float scale, const juce::LookAndFeel& lnf)
+    {
+        juce::Graphics g (canvas);
+        g.addTransform (juce::AffineTransform::scale (scale));
+        decorator.drawDecorator (g, bounds, lnf);
+        return decorator.getCachedBackground();
+    };
+
+    auto first = draw ({ 100, 100 }, 1.0f, lookAndFeel);
+    REQUIRE (first.isValid());
+    REQUIRE (draw ({ 100, 100 }, 1.0f, lookAndFeel) == first);
+
+    SECTION ("Size")
+    {
+        REQUIRE (draw ({ 100, 120 }, 1.0f, lookAndFeel) != first);
+    }
+
+    SECTION ("Scale")
+    {
+        auto scaled = draw ({ 100, 100 }, 2.0f, lookAndFeel);
+        REQUIRE (scaled != first);
+        REQUIRE (scaled.getWidth() == 200);
+    }
+
+    SECTION ("Style")
+    {
+        node.setProperty (foleys::IDs::backgroundColour, "blue", nullptr);
+        decorator.updateColours (builder, node);
+
+        auto restyled = draw ({ 100, 100 }, 1.0f, lookAndFeel);
+        REQUIRE (restyled != first);
+        REQUIRE (restyled.getPixelAt (50, 50) == juce::Colours::blue);
+    }
+
+    SECTION ("LookAndFeel")
+    {
+        juce::LookAndFeel_V4 otherLookAndFeel;
+        REQUIRE (draw ({ 100, 100 }, 1.0f, otherLookAndFeel) != first);
+    }
+}
+
+TEST_CASE ("Image pyramid", "[gui]")
+{
+    SECTION ("Level selection")
+    {
+        REQUIRE (foleys::ImagePyramid::getLevelIndex (1024, 1024, 1024, 1024) == 0);
+        REQUIRE (foleys::ImagePyramid::getLevelIndex (1024, 1024, 2000, 2000) == 0);
+        REQUIRE (foleys::ImagePyramid::getLevelIndex (1024, 1024, 512, 512) == 1);
+        REQUIRE (foleys::ImagePyramid::getLevelIndex (1024, 1024, 200, 200) == 2);
+        REQUIRE (foleys::ImagePyramid::getLevelIndex (1000, 500, 250, 100) == 2);
+        REQUIRE (foleys::ImagePyramid::getLevelIndex (1000, 500, 100, 300) == 0);
+    }
+
+    SECTION ("Pyramids of the same image share their frames")
+    {
+        juce::Image filmStrip (juce::Image::ARGB, 64, 64 * 4, true);
+        filmStrip.clear ({ 0, 64, 64, 64 }, juce::Colours::red);
+
+        foleys::ImagePyramid first, second;
+        first.setImage (filmStrip, 4);
+        second.setImage (filmStrip, 4);
+
+        auto frame = first.getScaledFrame (1, 32, 32);
+        REQUIRE (frame.getWidth() == 32);
+        REQUIRE (frame.getHeight() == 32);
+        REQUIRE (frame.getPixelAt (16, 16) == juce::Colours::red);
+        REQUIRE (first.getScaledFrame (0, 32, 32).getPixelAt (16, 16) == juce::Colours::transparentBlack);
+
+        REQUIRE (second.getScaledFrame (1, 32, 32) == frame);
+        REQUIRE (second.getScaledFrame (1, 48, 48) != frame);
+
+        foleys::ImagePyramid other;
+        other.setImage (filmStrip.createCopy(), 4);
+        REQUIRE (other.getScaledFrame (1, 32, 32) != frame);
+    }
+}
+
+TEST_CASE ("Image asset cache", "[gui]")
+{
+    std::atomic<int>    numDecoded { 0 };
+    juce::WaitableEvent decodingSlow, finishSlow;
+
+    // each image has 100 * 100 * 4 = 40000 bytes
+    foleys::ImageAssetCache cache ([&] (const juce::String& name)
+    {
+        ++numDecoded;
+
+        if (name == "slow")
+        {
+            decodingSlow.signal();
+            finishSlow.wait();
+        }
+
+        return name == "missing" ? juce::Image() : juce::Image (juce::Image::ARGB, 100, 100, true);
+    });
+
+    SECTION ("Hit and miss")
+    {
+        auto image = cache.getImage ("a");
+        REQUIRE (image.isValid());
+        REQUIRE (cache.getImage ("a") == image);
+        REQUIRE (numDecoded == 1);
+
+        REQUIRE (cache.getImage ("missing").isNull());
+
+        const auto statistics = cache.getStatistics();
+        REQUIRE (statistics.hits == 1);
+        REQUIRE (statistics.misses == 2);
+        REQUIRE (statistics.numImages == 1);
+        REQUIRE (statistics.bytesInUse == 40000);
+    }
+
+    SECTION ("Concurrent decode of the same image")
+    {
+        juce::Image first, second;
+
+        std::thread decoding ([&] { first = cache.getImage ("slow"); });
+        decodingSlow.wait();
+
+        std::thread waiting ([&] { second = cache.getImage ("slow"); });
+        juce::Thread::sleep (50);
+        finishSlow.signal();
+
+        decoding.join();
+        waiting.join();
+
+        REQUIRE (first.isValid());
+        REQUIRE (second == first);
+        REQUIRE (numDecoded == 1);
+    }
+
+    SECTION ("Eviction within the byte budget")
+    {
+        cache.setMemoryBudget (100000);
+
+        cache.getImage ("a");
+        cache.getImage ("b");
+        auto kept = cache.getImage ("c");
+
+        // a was used least recently and is not referenced anywhere else
+        auto statistics = cache.getStatistics();
+        REQUIRE (statistics.evictions == 1);
+        REQUIRE (statistics.numImages == 2);
+        REQUIRE (statistics.bytesInUse == 80000);
+
+        cache.getImage ("a");
+        REQUIRE (numDecoded == 4);
+
+        // images still in use are not evicted, even if the budget is exceeded
+        cache.setMemoryBudget (0);
+        statistics = cache.getStatistics();
+        REQUIRE (statistics.numImages == 1);
+        REQUIRE (statistics.bytesInUse == 40000);
+        REQUIRE (cache.getImage ("c") == kept);
+    }
+}
+
+TEST_CASE ("Layer cache", "[gui]")
+{
+    // each layer has 10 * 10 * 4 = 400 bytes, so four fit into the budget
+    foleys::LayerCache cache (1600);
+
+    juce::Image image (juce::Image::ARGB, 10, 10, true);
+    juce::Graphics g (image);
+
+    SECTION ("Cached layers are painted once")
+    {
+        int numPainted = 0;
+        for (int i = 0; i < 10; ++i)
+            cache.draw (g, { 0, 0, 10, 10 }, foleys::LayerCache::Key().add (1), [&] (juce::Graphics&) { ++numPainted; });
+
+        REQUIRE (numPainted == 1);
+        REQUIRE (cache.getNumMisses() == 1);
+    }
+
+    SECTION ("A cyclic working set above the budget stays partly cached")
+    {
+        for (int cycle = 0; cycle < 10; ++cycle)
+            for (int layer = 0; layer < 8; ++layer)
+                cache.draw (g, { 0, 0, 10, 10 }, foleys::LayerCache::Key().add (layer), [] (juce::Graphics&) {});
+
+        // dropping the least recently used layer would miss every single time
+        REQUIRE (cache.getNumLayers() == 4);
+        REQUIRE (cache.getNumMisses() == 8 + 9 * 5);
+    }
+}
+
+TEST_CASE ("Rotary slider layers", "[gui]")
+{
+    juce::Slider slider (juce::Slider::RotaryHorizontalVerticalDrag, juce::Slider::NoTextBox);
+    slider.setRange (0.0, 10.0);
+    slider.setBounds (0, 0, 240, 240);
+
+    const auto startAngle = juce::MathConstants<float>::pi * 1.2f;
+    const auto endAngle   = juce::MathConstants<float>::pi * 2.8f;
+
+    auto paint = [&] (foleys::LookAndFeel& lookAndFeel)
+    {
+        juce::Image image (juce::Image::ARGB, 240, 240, true);
+        juce::Graphics g (image);
+        lookAndFeel.drawRotarySlider (g, 0, 0, 240, 240, 0.3f, startAngle, endAngle, slider);
+        return image;
+    };
+
+    auto isSameImage = [] (const juce::Image& a, const juce::Image& b)
+    {
+        for (int y = 0; y < a.getHeight(); ++y)
+            for (int x = 0; x < a.getWidth(); ++x)
+                if (a.getPixelAt (x, y) != b.getPixelAt (x, y))
+                    return false;
+
+        return true;
+    };
+
+    foleys::LookAndFeel cached;
+    const auto before = paint (cached);
+
+    SECTION ("The cached layer matches painting it fresh")
+    {
+        foleys::LookAndFeel fresh;
+        REQUIRE (isSameImage (paint (cached), paint (fresh)));
+    }
+
+    SECTION ("Changed formatting isn't drawn from the cache")
+    {
+        slider.textFromValueFunction = [] (double value) { return juce::String (value * 10.0) + "%"; };
+
+        foleys::LookAndFeel fresh;
+        const auto after = paint (cached);
+        REQUIRE (isSameImage (after, paint (fresh)));
+        REQUIRE_FALSE (isSameImage (after, before));
+    }
+}
+
+TEST_CASE ("Paint profiler", "[gui]")
+{
+    foleys::PaintProfiler profiler;
+    profiler.setEnabled (true);
+
+    juce::Component outer, inner;
+    juce::Image image (juce::Image::ARGB, 10, 10, true);
+    juce::Graphics g (image);
+
+    auto findEntry = [&] (const juce::Component& component)
+    {
+        for (const auto& entry : profiler.getEntries())
+            if (entry.component == &component)
+                return entry;
+
+        return foleys::PaintProfiler::Entry();
+    };
+
+    SECTION ("Nested paints are subtracted from the self time")
+    {
+        {
+            foleys::PaintProfiler::ScopedPaint outerPaint (profiler, outer, g, "outer");
+            juce::Thread::sleep (2);
+            {
+                foleys::PaintProfiler::ScopedPaint innerPaint (profiler, inner, g, "inner");
+                juce::Thread::sleep (5);
+            }
+        }
+
+        const auto outerEntry = findEntry (outer);
+        const auto innerEntry = findEntry (inner);
+
+        REQUIRE (outerEntry.numPaints == 1);
+        REQUIRE (innerEntry.numPaints == 1);
+        REQUIRE (innerEntry.selfMilliseconds == innerEntry.totalMilliseconds);
+        REQUIRE (outerEntry.totalMilliseconds > innerEntry.totalMilliseconds);
+        REQUIRE (std::abs (outerEntry.selfMilliseconds - (outerEntry.totalMilliseconds - innerEntry.totalMilliseconds)) < 0.001);
+        REQUIRE (outerEntry.paintedArea == 100);
+    }
+
+    SECTION ("A paint that didn't finish is dropped")
+    {
+        const auto outerStart = profiler.startPaint (outer);
+        profiler.startPaint (inner);
+        profiler.addPaint (outer, "outer", outerStart, { 0, 0, 10, 10 });
+
+        REQUIRE (findEntry (outer).numPaints == 1);
+        REQUIRE (findEntry (inner).numPaints == 0);
+    }
+
+    SECTION ("The ignored component is not measured, the others are")
+    {
+        profiler.setIgnoredComponent (&inner);
+        {
+            foleys::PaintProfiler::ScopedPaint outerPaint (profiler, outer, g, "outer");
+            foleys::PaintProfiler::ScopedPaint innerPaint (profiler, inner, g, "inner");
+        }
+
+        REQUIRE (findEntry (outer).numPaints == 1);
+        REQUIRE (findEntry (inner).numPaints == 0);
+    }
+
+    SECTION ("Nothing is recorded while disabled")
+    {
+        profiler.setEnabled (false);
+        {
+            foleys::PaintProfiler::ScopedPaint outerPaint (profiler, outer, g, "outer");
+        }
+
+        REQUIRE (profiler.getEntries().empty());
+    }
+}
@@ -36,6 +36,9 @@
 
 #include <foleys_gui_magic/foleys_gui_magic.h>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <thread>
 
 #include "foleys_TestProcessors.h"
 
@@ -45,3 +48,336 @@ TEST_CASE ("MagicProcessor test", "[processor]")
     std::unique_ptr<juce::AudioProcessorEditor> editor (processor->createEditor());
     REQUIRE (editor.get() != nullptr);
 }
+
+TEST_CASE ("Playhead information", "[processor]")
+{
+    struct TestPlayHead : public juce::AudioPlayHead
+    {
+        juce::Optional<PositionInfo> getPosition() const override
+        {
+            PositionInfo info;
+            info.setBpm (140.0);
+            info.setPpqPosition (17.5);
+            info.setPpqPositionOfLastBarStart (16.0);
+            info.setLoopPoints (juce::AudioPlayHead::LoopPoints { 8.0, 24.0 });
+            info.setIsLooping (true);
+            info.setIsPlaying (true);
+            return info;
+        }
+    };
+
+    UnitTestProcessor processor;
+    TestPlayHead      playhead;
+
+    auto& state = processor.getMagicState();
+    state.updatePlayheadInformation (&playhead);
+
+    const auto info = state.getPlayheadInformation();
+    REQUIRE (info.bpm == 140.0);
+    REQUIRE (info.ppqPosition == 17.5);
+    REQUIRE (info.ppqLastBarStart == 16.0);
+    REQUIRE (info.ppqLoopStart == 8.0);
+    REQUIRE (info.ppqLoopEnd == 24.0);
+    REQUIRE (info.isLooping);
+    REQUIRE (info.isPlaying);
+    REQUIRE (! info.isRecording);
+}
+
+TEST_CASE ("Property mirror", "[state]")
+{
+    foleys::MagicGUIState state;
+
+    auto* mirror = state.getPropertyMirror<float> ("gui:gain");
+    REQUIRE (mirror != nullptr);
+    REQUIRE (state.getPropertyMirror<float> ("gui:gain") == mirror);
+
+    state.getPropertyAsValue ("gui:gain").setValue (0.5f);
+    REQUIRE (mirror->get() == 0.5f);
+}
+
+TEST_CASE ("Property bridge", "[state]")
+{
+    struct Band
+    {
+        float frequency = 0.0f;
+        bool  active    = false;
+    };
+
+    foleys::MagicGUIState state;
+
+    auto gain = state.bindProperty<float> ("gui:gain");
+    auto band = state.bindPropertyNode<Band> ("eq:band1", [](const juce::ValueTree& node)
+    {
+        return Band { node.getProperty ("frequency"), node.getProperty ("active") };
+    });
+
+    REQUIRE (gain.isValid());
+    REQUIRE (band.isValid());
+
+    state.getPropertyAsValue ("gui:gain").setValue (0.5f);
+    state.getPropertyAsValue ("eq:band1:frequency").setValue (440.0f);
+    state.getPropertyAsValue ("eq:band1:active").setValue (true);
+
+    foleys::PropertyBridge::Snapshot snapshot;
+    state.getPropertyBridge().takeSnapshot (snapshot);
+
+    REQUIRE (state.getPropertyBridge().get (gain) == 0.5f);
+    REQUIRE (snapshot.get (gain) == 0.5f);
+    REQUIRE (band.get().frequency == 440.0f);
+    REQUIRE (band.get().active);
+}
+
+TEST_CASE ("Property bridge follows restored state", "[state]")
+{
+    UnitTestProcessor processor;
+    auto& state = processor.getMagicState();
+
+    auto gain = state.bindProperty<float> ("gui:gain");
+    auto* mirror = state.getPropertyMirror<float> ("gui:gain");
+    state.getPropertyAsValue ("gui:gain").setValue (0.5f);
+
+    juce::MemoryBlock data;
+    processor.getStateInformation (data);
+
+    state.getPropertyAsValue ("gui:gain").setValue (0.2f);
+    processor.setStateInformation (data.getData(), int (data.getSize()));
+
+    // no message loop ran, the bindings and mirrors must be updated synchronously
+    REQUIRE (state.getPropertyBridge().get (gain) == 0.5f);
+    REQUIRE (mirror->get() == 0.5f);
+}
+
+TEST_CASE ("Property bridge follows a state restored on another thread", "[state]")
+{
+    UnitTestProcessor processor;
+    auto& state = processor.getMagicState();
+
+    auto gain = state.bindProperty<float> ("gui:gain");
+    auto* mirror = state.getPropertyMirror<float> ("gui:gain");
+    state.getPropertyAsValue ("gui:gain").setValue (0.5f);
+
+    juce::MemoryBlock data;
+    processor.getStateInformation (data);
+
+    state.getPropertyAsValue ("gui:gain").setValue (0.2f);
+
+    std::thread restoring ([&]
+    {
+        processor.setStateInformation (data.getData(), int (data.getSize()));
+    });
+
+    restoring.join();
+
+    // the restored values are published right away, the nodes are connected later on the message thread
+    REQUIRE (state.getPropertyBridge().get (gain) == 0.5f);
+    REQUIRE (mirror->get() == 0.5f);
+}
+
+TEST_CASE ("Visualisers idle without consumers", "[visualiser]")
+{
+    foleys::MagicLevelSource level;
+    level.setupSource (1, 48000.0, 500);
+
+    juce::AudioBuffer<float> buffer (1, 64);
+    buffer.clear();
+    buffer.setSample (0, 0, 0.5f);
+
+    // by default the source processes, even if nobody registered
+    foleys::MagicLevelSource ungated;
+    ungated.setupSource (1, 48000.0, 500);
+    ungated.pushSamples (buffer);
+    REQUIRE (ungated.getMaxValue (0) == 0.5f);
+
+    level.setIdleWithoutConsumers (true);
+
+    level.pushSamples (buffer);
+    REQUIRE (level.getMaxValue (0) == 0.0f);
+
+    foleys::MagicLevelMeter meter;
+    meter.setLevelSource (&level);
+    REQUIRE (level.hasConsumers());
+
+    level.pushSamples (buffer);
+    REQUIRE (level.getMaxValue (0) == 0.5f);
+
+    meter.setLevelSource (nullptr);
+    REQUIRE_FALSE (level.hasConsumers());
+
+    SECTION ("Switched for all sources of a state")
+    {
+        foleys::MagicGUIState state;
+        auto* before = state.createAndAddObject<foleys::MagicLevelSource> ("before");
+        state.setVisualisersIdleWithoutConsumers (true);
+        auto* after  = state.createAndAddObject<foleys::MagicOscilloscope> ("after");
+
+        REQUIRE_FALSE (before->isProcessing());
+        REQUIRE_FALSE (after->isProcessing());
+
+        state.setVisualisersIdleWithoutConsumers (false);
+        REQUIRE (before->isProcessing());
+        REQUIRE (after->isProcessing());
+    }
+}
+
+TEST_CASE ("Editor cache", "[gui]")
+{
+    UnitTestProcessor processor;
+    auto& state = processor.getMagicState();
+    auto* scope = state.createAndAddObject<foleys::MagicOscilloscope> ("scope");
+    state.setEditorCacheTimeout (60000);
+
+    std::unique_ptr<juce::AudioProcessorEditor> editor (processor.createEditor());
+    auto* builder = &dynamic_cast<foleys::MagicPluginEditor*> (editor.get())->getGUIBuilder();
+
+    builder->getGuiRootNode().appendChild (juce::ValueTree (foleys::IDs::plot, { { foleys::IDs::source, "scope" } }), nullptr);
+    REQUIRE (scope->hasConsumers());
+
+    juce::Component::SafePointer<juce::Component> root (builder->findGuiItem (builder->getGuiRootNode()));
+    REQUIRE (root != nullptr);
+
+    // the cached GUI must not keep the visualisers running
+    editor.reset();
+    REQUIRE (root != nullptr);
+    REQUIRE_FALSE (scope->hasConsumers());
+
+    editor.reset (processor.createEditor());
+    REQUIRE (&dynamic_cast<foleys::MagicPluginEditor*> (editor.get())->getGUIBuilder() == builder);
+    REQUIRE (builder->findGuiItem (builder->getGuiRootNode()) == root.getComponent());
+    REQUIRE (root->getParentComponent() == editor.get());
+    REQUIRE (scope->hasConsumers());
+
+    // changing the GUI tree while the editor is closed outdates the cached GUI
+    editor.reset();
+    builder->getGuiRootNode().appendChild (juce::ValueTree (foleys::IDs::plot, { { foleys::IDs::source, "scope" } }), nullptr);
+    REQUIRE (root == nullptr);
+    REQUIRE_FALSE (scope->hasConsumers());
+
+    editor.reset (processor.createEditor());
+    REQUIRE (builder->findGuiItem (builder->getGuiRootNode()) != nullptr);
+    REQUIRE (scope->hasConsumers());
+}
+
+TEST_CASE ("Visualiser worker pool", "[visualiser]")
+{
+    struct CountingJob : public foleys::VisualiserWorkerPool::WakeableJob
+    {
+        int useTimeSlice() override
+        {
+            // a wake up while running must not be lost when the job parks afterwards
+            if (++calls == 2)
+                pool->wakeUp (*this);
+
+            return foleys::VisualiserWorkerPool::parkUntilWokenUp;
+        }
+
+        foleys::SharedVisualiserWorkerPool pool;
+        std::atomic<int> calls { 0 };
+    };
+
+    foleys::SharedVisualiserWorkerPool pool;
+    CountingJob job;
+
+    pool->addJob (&job, &job);
+
+    for (int i = 0; i < 100 && job.calls.load() == 0; ++i)
+        juce::Thread::sleep (10);
+
+    REQUIRE (job.calls.load() == 1);
+
+    pool->wakeUp (job);
+
+    for (int i = 0; i < 100 && job.calls.load() < 3; ++i)
+        juce::Thread::sleep (10);
+
+    juce::Thread::sleep (50);
+    REQUIRE (job.calls.load() == 3);
+
+    pool->removeJobsOf (&job);
+}
+
+TEST_CASE ("Background plot paths of a shared source", "[visualiser]")
+{
+    foleys::MagicGUIState state;
+    auto* filterPlot = state.createAndAddObject<foleys::MagicFilterPlot> ("filter");
+    filterPlot->prepareToPlay (48000.0, 512);
+    filterPlot->setIIRCoefficients (juce::dsp::IIR::Coefficients<float>::makePeakFilter (48000.0, 1000.0f, 1.0f, 4.0f), 24.0f);
+
+    auto& builder = state.getPlotPathBuilder (*filterPlot);
+    REQUIRE (&state.getPlotPathBuilder (*filterPlot) == &builder);
+
+    // both plots are built by the one builder of the source, in their own size
+    foleys::MagicPlotComponent component;
+    auto small = builder.createTarget (component);
+    auto large = builder.createTarget (component);
+    small->setSize ({ 0.0f, 0.0f, 100.0f, 50.0f });
+    large->setSize ({ 0.0f, 0.0f, 400.0f, 200.0f });
+
+    auto waitForGeneration = [&](int generation)
+    {
+        for (int i = 0; i < 100 && (small->getGeneration() < generation || large->getGeneration() < generation); ++i)
+            juce::Thread::sleep (10);
+    };
+
+    waitForGeneration (1);
+
+    auto smallPaths = small->getPaths();
+    auto largePaths = large->getPaths();
+    REQUIRE (smallPaths != nullptr);
+    REQUIRE (largePaths != nullptr);
+    REQUIRE (smallPaths->path.getBounds().getRight() <= 100.0f);
+    REQUIRE (smallPaths->filledPath.getBounds().getBottom() <= 50.0f);
+    REQUIRE (largePaths->path.getBounds().getRight() > 100.0f);
+
+    SECTION ("New data is built once the frame asks for it")
+    {
+        // the data timestamp has a resolution of milliseconds
+        juce::Thread::sleep (5);
+        filterPlot->setIIRCoefficients (juce::dsp::IIR::Coefficients<float>::makePeakFilter (48000.0, 2000.0f, 1.0f, 4.0f), 24.0f);
+
+        small->checkForNewData();
+        large->checkForNewData();
+        waitForGeneration (2);
+
+        REQUIRE (small->getGeneration() == 2);
+        REQUIRE (large->getGeneration() == 2);
+        REQUIRE (small->getPaths() != smallPaths);
+    }
+}
+
+TEST_CASE ("Filter plot magnitudes", "[visualiser]")
+{
+    foleys::MagicFilterPlot plot;
+    plot.prepareToPlay (48000.0, 512);
+    plot.setFrequencyGrid (1000.0, 2000.0, 2);
+
+    auto peak = juce::dsp::IIR::Coefficients<float>::makePeakFilter (48000.0, 1000.0f, 1.0f, 4.0f);
+    plot.setIIRCoefficients (1.0f, { peak }, 24.0f);
+
+    foleys::MagicPlotComponent component;
+    juce::Path path, filledPath;
+    plot.createPlotPaths (path, filledPath, { 0.0f, 0.0f, 100.0f, 100.0f }, component);
+
+    // at the centre frequency the gain of 4 is log2 (4) = 2 above the centre line
+    const auto yFactor = 2.0f * 100.0f / juce::Decibels::decibelsToGain (24.0f);
+    REQUIRE (path.getBounds().getY() == Catch::Approx (50.0f - 2.0f * yFactor).margin (0.01));
+
+    SECTION ("The curve survives a new frequency grid")
+    {
+        plot.prepareToPlay (48000.0, 256);
+        plot.setFrequencyGrid (1000.0, 2000.0, 3);
+
+        juce::Path newPath, newFilledPath;
+        plot.createPlotPaths (newPath, newFilledPath, { 0.0f, 0.0f, 100.0f, 100.0f }, component);
+        REQUIRE (newPath.getBounds().getY() == Catch::Approx (50.0f - 2.0f * yFactor).margin (0.01));
+    }
+
+    SECTION ("Less than two points are clamped")
+    {
+        plot.setFrequencyGrid (1000.0, 2000.0, 1);
+
+        juce::Path newPath, newFilledPath;
+        plot.createPlotPaths (newPath, newFilledPath, { 0.0f, 0.0f, 100.0f, 100.0f }, component);
+        REQUIRE (newPath.getBounds().getY() == Catch::Approx (50.0f - 2.0f * yFactor).margin (0.01));
+        REQUIRE (std::isfinite (newPath.getBounds().getBottom()));
+    }
+}
@@ -0,0 +1,249 @@
+/*
+ ==============================================================================
+    Copyright (c) 2022 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    License for non-commercial projects:
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+    License for commercial products:
+
+    To sell commercial products containing this module, you are required to buy a
+    License from https://foleysfinest.com/developer/pluginguimagic/
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include <foleys_gui_magic/foleys_gui_magic.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+// The benchmarks are hidden, run them using: FoleysGUIMagicTests "[benchmark]"
+
+TEST_CASE ("Plot glow decay", "[.][benchmark]")
+{
+    juce::Image glowBuffer (juce::Image::ARGB, 1200, 400, true);
+    juce::Graphics g (glowBuffer);
+    g.fillAll (juce::Colours::orange.withAlpha (0.8f));
+
+    BENCHMARK ("multiplyAllAlphas full image")
+    {
+        glowBuffer.multiplyAllAlphas (0.9f);
+        return glowBuffer.getPixelAt (0, 0);
+    };
+
+    BENCHMARK ("decayImage full image")
+    {
+        foleys::decayImage (glowBuffer, glowBuffer.getBounds(), 0.9f);
+        return glowBuffer.getPixelAt (0, 0);
+    };
+
+    BENCHMARK ("decayImage plotted area")
+    {
+        foleys::decayImage (glowBuffer, { 0, 150, 1200, 100 }, 0.9f);
+        return glowBuffer.getPixelAt (0, 200);
+    };
+}
+
+TEST_CASE ("Image decay", "[visualiser]")
+{
+    juce::Image image (juce::Image::ARGB, 4, 4, true);
+    image.setPixelAt (1, 1, juce::Colours::white);
+
+    foleys::decayImage (image, image.getBounds(), 0.5f);
+
+    REQUIRE (image.getPixelAt (1, 1).getAlpha() == 127);
+    REQUIRE (image.getPixelAt (0, 0).getAlpha() == 0);
+
+    SECTION ("Slow decay still fades out")
+    {
+        image.setPixelAt (1, 1, juce::Colours::white);
+
+        const auto numFrames = foleys::getNumDecayFrames (0.999f);
+        REQUIRE (numFrames > 0);
+
+        for (int i = 0; i < numFrames; ++i)
+            foleys::decayImage (image, image.getBounds(), 0.999f);
+
+        REQUIRE (image.getPixelAt (1, 1).getAlpha() == 0);
+    }
+}
+
+TEST_CASE ("Plot vertices", "[visualiser]")
+{
+    const std::vector<juce::Point<float>> points { { 0.0f, 10.0f }, { 10.0f, 10.0f }, { 10.0f, 10.0f }, { 20.0f, 0.0f } };
+
+    SECTION ("Stroke")
+    {
+        std::vector<float> vertices;
+        foleys::createPlotStrokeVertices (points, 2.0f, vertices);
+
+        // two triangles per segment, the segment without length is skipped
+        REQUIRE (vertices.size() == 2 * 6 * 2);
+
+        // the horizontal segment is offset by half the line width
+        REQUIRE (vertices [0] == Catch::Approx (0.0f));
+        REQUIRE (vertices [1] == Catch::Approx (11.0f));
+        REQUIRE (vertices [3] == Catch::Approx (9.0f));
+        REQUIRE (vertices [10] == Catch::Approx (10.0f));
+        REQUIRE (vertices [11] == Catch::Approx (9.0f));
+    }
+
+    SECTION ("Fill")
+    {
+        std::vector<float> vertices;
+        foleys::createPlotFillVertices (points, 50.0f, vertices);
+
+        REQUIRE (vertices.size() == points.size() * 4);
+        REQUIRE (vertices [12] == Catch::Approx (20.0f));
+        REQUIRE (vertices [13] == Catch::Approx (0.0f));
+        REQUIRE (vertices [14] == Catch::Approx (20.0f));
+        REQUIRE (vertices [15] == Catch::Approx (50.0f));
+    }
+}
+
+TEST_CASE ("Plot line keeps sub paths apart", "[visualiser]")
+{
+    juce::Path path;
+    path.startNewSubPath (0.0f, 10.0f);
+    path.lineTo (10.0f, 0.0f);
+    path.startNewSubPath (20.0f, 10.0f);
+    path.lineTo (30.0f, 0.0f);
+
+    foleys::PlotLine line;
+    line.setPath (path);
+
+    REQUIRE (line.points.size() == 4);
+    REQUIRE (line.subPathStarts == std::vector<size_t> { 0, 2 });
+
+    SECTION ("Stroke")
+    {
+        std::vector<float> vertices;
+        foleys::createPlotStrokeVertices (line, { 5.0f, 5.0f }, 2.0f, vertices);
+
+        // no segment from the end of the first to the start of the second sub path
+        REQUIRE (vertices.size() == 2 * 6 * 2);
+    }
+
+    SECTION ("Fill")
+    {
+        std::vector<float> vertices;
+        foleys::createPlotFillVertices (line, { 5.0f, 5.0f }, 50.0f, vertices);
+
+        // two degenerate vertices connect the triangle strips
+        REQUIRE (vertices.size() == (4 * 2 + 2) * 2);
+        REQUIRE (vertices [8] == Catch::Approx (15.0f));
+        REQUIRE (vertices [9] == Catch::Approx (50.0f));
+        REQUIRE (vertices [10] == Catch::Approx (25.0f));
+        REQUIRE (vertices [11] == Catch::Approx (15.0f));
+        REQUIRE (vertices [12] == Catch::Approx (25.0f));
+        REQUIRE (vertices [13] == Catch::Approx (15.0f));
+    }
+}
+
+#if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
+TEST_CASE ("Plot OpenGL renderer", "[visualiser]")
+{
+    foleys::MagicPlotGLRenderer renderer;
+    juce::Component             plot;
+
+    REQUIRE_FALSE (renderer.isAvailable());
+    REQUIRE (renderer.getShaderError().isEmpty());
+
+    foleys::PlotLine line;
+    renderer.setPlot (&plot, { 0, 0, 100, 50 }, line, juce::Colours::black, juce::Colours::orange, juce::Colours::orange);
+    REQUIRE (renderer.hasPlot (&plot));
+
+    renderer.removePlot (&plot);
+    REQUIRE_FALSE (renderer.hasPlot (&plot));
+
+    SECTION ("Shaders compile in a real context")
+    {
+#if JUCE_MODAL_LOOPS_PERMITTED
+        // on a headless machine run this e.g. in Xvfb, Mesa's llvmpipe provides OpenGL
+        juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+        if (juce::Desktop::getInstance().getDisplays().displays.isEmpty())
+            SKIP ("No display to create an OpenGL context on");
+
+        juce::Component window;
+        window.setSize (200, 100);
+        window.addToDesktop (0);
+        window.setVisible (true);
+
+        juce::OpenGLContext context;
+        context.setRenderer (&renderer);
+        context.attachTo (window);
+
+        for (int i = 0; i < 200 && ! renderer.isAvailable() && renderer.getShaderError().isEmpty(); ++i)
+            juce::MessageManager::getInstance()->runDispatchLoopUntil (10);
+
+        // closing the context makes the renderer unavailable again
+        const auto available = renderer.isAvailable();
+        const auto error     = renderer.getShaderError();
+        context.detach();
+
+        if (! available && error.isEmpty())
+            SKIP ("No OpenGL context could be created");
+
+        INFO (error);
+        REQUIRE (available);
+        REQUIRE (error.isEmpty());
+#else
+        SKIP ("Waiting for the OpenGL context needs JUCE_MODAL_LOOPS_PERMITTED");
+#endif
+    }
+}
+#endif
+
+TEST_CASE ("Slider paint", "[.][benchmark]")
+{
+    juce::Slider slider (juce::Slider::RotaryHorizontalVerticalDrag, juce::Slider::NoTextBox);
+    slider.setRange (-24.0, 24.0);
+    slider.setBounds (0, 0, 240, 240);
+
+    juce::Image image (juce::Image::ARGB, 240, 240, true);
+    juce::Graphics g (image);
+
+    foleys::LookAndFeel lookAndFeel;
+    foleys::Skeuomorphic skeuomorphic;
+
+    const auto start = juce::MathConstants<float>::pi * 1.2f;
+    const auto end   = juce::MathConstants<float>::pi * 2.8f;
+    float position   = 0.0f;
+
+    BENCHMARK ("LookAndFeel per value change")
+    {
+        position = std::fmod (position + 0.01f, 1.0f);
+        lookAndFeel.drawRotarySlider (g, 0, 0, 240, 240, position, start, end, slider);
+        return image.getPixelAt (120, 120);
+    };
+
+    BENCHMARK ("Skeuomorphic per value change")
+    {
+        position = std::fmod (position + 0.01f, 1.0f);
+        skeuomorphic.drawRotarySlider (g, 0, 0, 240, 240, position, start, end, slider);
+        return image.getPixelAt (120, 120);
+    };
+}
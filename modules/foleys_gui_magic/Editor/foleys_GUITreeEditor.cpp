@@ -116,24 +116,82 @@ void GUITreeEditor::setSelectedNode (const juce::ValueTree& node)
     treeView.scrollToKeepItemVisible (itemToSelect);
 }
 
-void GUITreeEditor::valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&)
+GUITreeEditor::GuiTreeItem* GUITreeEditor::findItem (const juce::ValueTree& node) const
 {
-    updateTree();
+    if (rootItem.get() == nullptr || (node != tree && node.isAChildOf (tree) == false))
+        return nullptr;
+
+    std::stack<int> path;
+    auto probe = node;
+    while (probe != tree)
+    {
+        auto parent = probe.getParent();
+        path.push (parent.indexOf (probe));
+        probe = parent;
+    }
+
+    // sub items are only created when opened, so the node might not have an item yet
+    juce::TreeViewItem* item = rootItem.get();
+    while (path.empty() == false && item != nullptr)
+    {
+        item = item->getSubItem (path.top());
+        path.pop();
+    }
+
+    return dynamic_cast<GuiTreeItem*> (item);
 }
 
-void GUITreeEditor::valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&)
+void GUITreeEditor::valueTreePropertyChanged (juce::ValueTree& node, const juce::Identifier& property)
 {
-    updateTree();
+    // only these are displayed, changes like the position while dragging are ignored
+    if (property != IDs::id && property != IDs::caption)
+        return;
+
+    if (auto* item = findItem (node))
+        item->repaintItem();
 }
 
-void GUITreeEditor::valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int)
+void GUITreeEditor::valueTreeChildAdded (juce::ValueTree& parent, juce::ValueTree& child)
 {
-    updateTree();
+    auto* parentItem = findItem (parent);
+    if (parentItem == nullptr)
+        return;
+
+    if (parentItem->isOpen() || parentItem->getNumSubItems() > 0)
+        parentItem->addSubItem (new GuiTreeItem (builder, child), parent.indexOf (child));
+    else
+        parentItem->treeHasChanged();
 }
 
-void GUITreeEditor::valueTreeChildOrderChanged (juce::ValueTree&, int, int)
+void GUITreeEditor::valueTreeChildRemoved (juce::ValueTree& parent, juce::ValueTree& child, int index)
 {
-    updateTree();
+    auto* parentItem = findItem (parent);
+    if (parentItem == nullptr)
+        return;
+
+    if (auto* item = dynamic_cast<GuiTreeItem*> (parentItem->getSubItem (index)))
+    {
+        if (item->getTree() == child)
+        {
+            parentItem->removeSubItem (index);
+            return;
+        }
+    }
+
+    parentItem->treeHasChanged();
+}
+
+void GUITreeEditor::valueTreeChildOrderChanged (juce::ValueTree& parent, int oldIndex, int newIndex)
+{
+    auto* parentItem = findItem (parent);
+    if (parentItem == nullptr)
+        return;
+
+    if (auto* item = parentItem->getSubItem (oldIndex))
+    {
+        parentItem->removeSubItem (oldIndex, false);
+        parentItem->addSubItem (item, newIndex);
+    }
 }
 
 void GUITreeEditor::valueTreeParentChanged (juce::ValueTree&)
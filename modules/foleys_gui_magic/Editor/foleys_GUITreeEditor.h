@@ -88,6 +88,11 @@ private:
     };
 
 
+    /**
+     Returns the item showing node, or nullptr if that item was not opened yet
+     */
+    GuiTreeItem* findItem (const juce::ValueTree& node) const;
+
     void valueTreePropertyChanged (juce::ValueTree& treeWhosePropertyHasChanged,
                                    const juce::Identifier& property) override;
 
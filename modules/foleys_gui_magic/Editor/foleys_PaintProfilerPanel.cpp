@@ -0,0 +1,201 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_PaintProfilerPanel.h"
+
+namespace foleys
+{
+
+PaintProfilerPanel::PaintProfilerPanel (juce::Component* editorToOverlay)
+  : editor (editorToOverlay)
+{
+    recordButton.setClickingTogglesState (true);
+    recordButton.setToggleState (profiler->isEnabled(), juce::dontSendNotification);
+    recordButton.setColour (juce::TextButton::buttonOnColourId, EditorColours::selectedBackground);
+    recordButton.onClick = [&] { profiler->setEnabled (recordButton.getToggleState()); };
+
+    resetButton.onClick = [&]
+    {
+        profiler->reset();
+        timerCallback();
+    };
+
+    heatmapButton.setClickingTogglesState (true);
+    heatmapButton.setColour (juce::TextButton::buttonOnColourId, EditorColours::selectedBackground);
+    heatmapButton.onClick = [&] { setHeatmapVisible (heatmapButton.getToggleState()); };
+
+    recordButton.setConnectedEdges (juce::TextButton::ConnectedOnRight);
+    resetButton.setConnectedEdges (juce::TextButton::ConnectedOnLeft | juce::TextButton::ConnectedOnRight);
+    heatmapButton.setConnectedEdges (juce::TextButton::ConnectedOnLeft);
+
+    addAndMakeVisible (recordButton);
+    addAndMakeVisible (resetButton);
+    addAndMakeVisible (heatmapButton);
+    addAndMakeVisible (entryList);
+}
+
+PaintProfilerPanel::~PaintProfilerPanel()
+{
+    setHeatmapVisible (false);
+}
+
+void PaintProfilerPanel::paint (juce::Graphics& g)
+{
+    g.fillAll (EditorColours::background);
+}
+
+void PaintProfilerPanel::resized()
+{
+    auto bounds  = getLocalBounds();
+    auto buttons = bounds.removeFromTop (24);
+    auto w       = buttons.getWidth() / 3;
+
+    recordButton.setBounds (buttons.removeFromLeft (w));
+    resetButton.setBounds (buttons.removeFromLeft (w));
+    heatmapButton.setBounds (buttons);
+    entryList.setBounds (bounds);
+}
+
+void PaintProfilerPanel::visibilityChanged()
+{
+    if (isVisible())
+    {
+        startTimer (500);
+    }
+    else
+    {
+        stopTimer();
+        heatmapButton.setToggleState (false, juce::dontSendNotification);
+        setHeatmapVisible (false);
+    }
+}
+
+int PaintProfilerPanel::getNumRows()
+{
+    return int (entries.size());
+}
+
+void PaintProfilerPanel::paintListBoxItem (int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected)
+{
+    if (! juce::isPositiveAndBelow (rowNumber, entries.size()))
+        return;
+
+    const auto& entry = entries [size_t (rowNumber)];
+
+    if (rowIsSelected)
+        g.fillAll (EditorColours::selectedBackground.darker());
+
+    auto name = entry.name;
+    if (entry.component != nullptr && entry.component->getComponentID().isNotEmpty())
+        name << " #" << entry.component->getComponentID();
+
+    const auto average = entry.numPaints > 0 ? entry.totalMilliseconds / entry.numPaints : 0.0;
+
+    auto bounds = juce::Rectangle<int> (0, 0, width, height).reduced (4, 0);
+    g.setColour (EditorColours::text);
+    g.drawFittedText (name, bounds.removeFromLeft (width / 3), juce::Justification::left, 1);
+    g.drawFittedText (juce::String (entry.numPaints) + "x " + juce::String (entry.selfMilliseconds, 1) + " ms self, "
+                      + juce::String (entry.totalMilliseconds, 1) + " ms total"
+                      + " (avg " + juce::String (average, 2) + ", max " + juce::String (entry.maxMilliseconds, 2) + ")"
+                      + " " + juce::String (entry.paintedArea / 1000) + " kpx",
+                      bounds, juce::Justification::right, 1);
+}
+
+void PaintProfilerPanel::timerCallback()
+{
+    entries = profiler->getEntries();
+    entryList.updateContent();
+    entryList.repaint();
+
+    if (heatmap != nullptr)
+        heatmap->repaint();
+}
+
+void PaintProfilerPanel::setHeatmapVisible (bool shouldBeVisible)
+{
+    if (shouldBeVisible && editor != nullptr)
+    {
+        heatmap = std::make_unique<Heatmap>(*this);
+        heatmap->setBounds (editor->getLocalBounds());
+        editor->addAndMakeVisible (heatmap.get());
+
+        // only the heatmap itself is skipped, recording doesn't depend on it being painted
+        profiler->setIgnoredComponent (heatmap.get());
+    }
+    else
+    {
+        profiler->setIgnoredComponent (nullptr);
+        heatmap.reset();
+    }
+}
+
+//==============================================================================
+
+PaintProfilerPanel::Heatmap::Heatmap (PaintProfilerPanel& ownerToUse)
+  : owner (ownerToUse)
+{
+    setInterceptsMouseClicks (false, false);
+    setAlwaysOnTop (true);
+}
+
+void PaintProfilerPanel::Heatmap::paint (juce::Graphics& g)
+{
+    auto maxTime = 0.0;
+    for (const auto& entry : owner.entries)
+        maxTime = std::max (maxTime, entry.selfMilliseconds);
+
+    auto* parent = getParentComponent();
+    if (maxTime <= 0.0 || parent == nullptr)
+        return;
+
+    std::vector<std::pair<juce::Rectangle<int>, double>> areas;
+    for (const auto& entry : owner.entries)
+        if (entry.component != nullptr && entry.component->isShowing())
+            areas.push_back ({ parent->getLocalArea (entry.component, entry.component->getLocalBounds()), entry.selfMilliseconds });
+
+    // containers first, so nested items are drawn on top of them
+    std::sort (areas.begin(), areas.end(), [] (const auto& a, const auto& b)
+    {
+        return a.first.getWidth() * a.first.getHeight() > b.first.getWidth() * b.first.getHeight();
+    });
+
+    for (const auto& area : areas)
+    {
+        g.setColour (juce::Colours::red.withAlpha (0.6f * float (area.second / maxTime)));
+        g.fillRect (area.first);
+        g.setColour (juce::Colours::red);
+        g.drawRect (area.first);
+    }
+}
+
+} // namespace foleys
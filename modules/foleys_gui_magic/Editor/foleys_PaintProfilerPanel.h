@@ -0,0 +1,92 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace foleys
+{
+
+/**
+ The PaintProfilerPanel shows the measurements of the PaintProfiler in the ToolBox,
+ the highest self time first. The heatmap colours each measured component in the
+ editor by its self time.
+ */
+class PaintProfilerPanel  : public juce::Component,
+                            private juce::ListBoxModel,
+                            private juce::Timer
+{
+public:
+    PaintProfilerPanel (juce::Component* editorToOverlay);
+    ~PaintProfilerPanel() override;
+
+    void paint (juce::Graphics& g) override;
+
+    void resized() override;
+
+    void visibilityChanged() override;
+
+private:
+    int getNumRows() override;
+    void paintListBoxItem (int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected) override;
+
+    void timerCallback() override;
+
+    void setHeatmapVisible (bool shouldBeVisible);
+
+    class Heatmap : public juce::Component
+    {
+    public:
+        Heatmap (PaintProfilerPanel& owner);
+        void paint (juce::Graphics& g) override;
+    private:
+        PaintProfilerPanel& owner;
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Heatmap)
+    };
+
+    juce::Component::SafePointer<juce::Component> editor;
+    SharedPaintProfiler                           profiler;
+    std::vector<PaintProfiler::Entry>             entries;
+
+    juce::TextButton recordButton  { TRANS ("Record") };
+    juce::TextButton resetButton   { TRANS ("Reset") };
+    juce::TextButton heatmapButton { TRANS ("Heatmap") };
+    juce::ListBox    entryList     { {}, this };
+
+    std::unique_ptr<Heatmap> heatmap;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PaintProfilerPanel)
+};
+
+} // namespace foleys
@@ -297,6 +297,7 @@ void PropertiesEditor::addDecoratorProperties()
     array.add (new StyleChoicePropertyComponent (builder, IDs::imagePlacement, styleItem, { IDs::imageCentred, IDs::imageFill, IDs::imageStretch }));
     array.add (new StyleTextPropertyComponent (builder, IDs::backgroundAlpha, styleItem));
     array.add (new StyleGradientPropertyComponent (builder, IDs::backgroundGradient, styleItem));
+    array.add (new StyleBoolPropertyComponent (builder, IDs::cacheBackground, styleItem));
 
     properties.addSection ("Decorator", array, false);
 }
@@ -307,19 +308,15 @@ void PropertiesEditor::addTypeProperties (juce::Identifier type, juce::Array<juc
 
     array.addArray (additional);
 
-    juce::ValueTree node (type);
-    if (auto item = builder.createGuiItem (node))
+    for (auto& p : builder.getSettableProperties (type, styleItem))
     {
-        for (auto& p : item->getSettableProperties())
-        {
-            if (auto* component = builder.createStylePropertyComponent (p, styleItem))
-                array.add (component);
-        }
+        if (auto* component = builder.createStylePropertyComponent (p, styleItem))
+            array.add (component);
+    }
 
-        for (auto colour : item->getColourNames())
-        {
-            array.add (new StyleColourPropertyComponent (builder, colour, styleItem));
-        }
+    for (auto colour : builder.getColourNames (type))
+    {
+        array.add (new StyleColourPropertyComponent (builder, colour, styleItem));
     }
 
     properties.addSection (type.toString(), array, false);
@@ -101,6 +101,18 @@ ToolBox::ToolBox (juce::Component* parentToUse, MagicGUIBuilder& builderToContro
                               properties->setValue ("alwaysOnTop", isAlwaysOnTop() ? "true" : "false");
                       });
 
+#if FOLEYS_ENABLE_PAINT_PROFILER
+        view.addSeparator();
+        view.addItem ("Paint Profiler", true, showPaintProfiler,
+                      [&]()
+                      {
+                          showPaintProfiler = !showPaintProfiler;
+                          palette.setVisible (!showPaintProfiler);
+                          paintProfilerPanel.setVisible (showPaintProfiler);
+                          resized();
+                      });
+#endif
+
         view.showMenuAsync (juce::PopupMenu::Options());
     };
 
@@ -116,6 +128,10 @@ ToolBox::ToolBox (juce::Component* parentToUse, MagicGUIBuilder& builderToContro
     addAndMakeVisible (resizer3);
     addAndMakeVisible (palette);
 
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    addChildComponent (paintProfilerPanel);
+#endif
+
     resizeManager.setItemLayout (0, 1, -1.0, -0.4);
     resizeManager.setItemLayout (1, 6, 6, 6);
     resizeManager.setItemLayout (2, 1, -1.0, -0.3);
@@ -148,6 +164,9 @@ ToolBox::~ToolBox()
     stopTimer (Timers::WindowDrag);
     stopTimer (Timers::AutoSave);
 
+    observedConfig.removeListener (this);
+    autoSavePool.removeAllJobs (false, 5000);
+
     if (autoSaveFile.existsAsFile() && lastLocation.hasIdenticalContentTo (autoSaveFile))
         autoSaveFile.deleteFile();
 }
@@ -215,11 +234,17 @@ void ToolBox::loadGUI (const juce::File& xmlFile)
 
 bool ToolBox::saveGUI (const juce::File& xmlFile)
 {
+    return writeTreeToFile (builder.getConfigTree(), xmlFile);
+}
+
+bool ToolBox::writeTreeToFile (const juce::ValueTree& tree, const juce::File& xmlFile)
+{
+    // the file is replaced by renaming, so a crash while writing doesn't leave a broken file
     juce::TemporaryFile temp (xmlFile);
 
     if (auto stream = temp.getFile().createOutputStream())
     {
-        auto saved = stream->writeString (builder.getConfigTree().toXmlString());
+        auto saved = stream->writeString (tree.toXmlString());
         stream.reset();
 
         if (saved)
@@ -229,6 +254,20 @@ bool ToolBox::saveGUI (const juce::File& xmlFile)
     return false;
 }
 
+void ToolBox::autoSave()
+{
+    if (autoSavedGeneration == configGeneration || autoSavePool.getNumJobs() > 0)
+        return;
+
+    autoSavedGeneration = configGeneration;
+
+    // copying the tree is cheap compared to serialising it, which happens on the pool
+    autoSavePool.addJob ([snapshot = builder.getConfigTree().createCopy(), file = autoSaveFile]
+    {
+        writeTreeToFile (snapshot, file);
+    });
+}
+
 void ToolBox::setSelectedNode (const juce::ValueTree& node)
 {
     treeEditor.setSelectedNode (node);
@@ -243,6 +282,11 @@ void ToolBox::setNodeToEdit (juce::ValueTree node)
 
 void ToolBox::stateWasReloaded()
 {
+    observedConfig.removeListener (this);
+    observedConfig = builder.getConfigTree();
+    observedConfig.addListener (this);
+    ++configGeneration;
+
     treeEditor.updateTree();
     propertiesEditor.setStyle (builder.getStylesheet().getCurrentStyle());
     palette.update();
@@ -270,6 +314,11 @@ void ToolBox::resized()
 
     juce::Component* comps[] = { &treeEditor, &resizer1, &propertiesEditor, &resizer3, &palette };
 
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    if (showPaintProfiler)
+        comps[4] = &paintProfilerPanel;
+#endif
+
     resizeManager.layOutComponents (comps, 5, bounds.getX(), bounds.getY(), bounds.getWidth(), bounds.getHeight(), true, true);
 
     const int  resizeCornerSize { 20 };
@@ -341,7 +390,7 @@ void ToolBox::timerCallback (int timer)
     if (timer == Timers::WindowDrag)
         updateToolboxPosition();
     else if (timer == Timers::AutoSave)
-        saveGUI (autoSaveFile);
+        autoSave();
 }
 
 void ToolBox::setToolboxPosition (PositionOption position)
@@ -387,6 +436,7 @@ void ToolBox::setLastLocation (juce::File file)
 
     autoSaveFile.deleteFile();
     autoSaveFile = lastLocation.getParentDirectory().getNonexistentChildFile (file.getFileNameWithoutExtension() + ".sav", ".xml");
+    autoSavedGeneration = 0;
 
     startTimer (Timers::AutoSave, 10000);
 }
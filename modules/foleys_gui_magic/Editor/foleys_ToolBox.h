@@ -36,6 +36,7 @@
 #include "foleys_GUITreeEditor.h"
 #include "foleys_Palette.h"
 #include "foleys_PropertiesEditor.h"
+#include "foleys_PaintProfilerPanel.h"
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
@@ -53,6 +54,7 @@ class ToolBox
   , public juce::KeyListener
   , private juce::MultiTimer
   , private foleys::MagicGUIBuilder::Listener
+  , private juce::ValueTree::Listener
 {
 public:
     /**
@@ -113,6 +115,16 @@ private:
 
     static std::unique_ptr<juce::FileFilter> getFileFilter();
 
+    static bool writeTreeToFile (const juce::ValueTree& tree, const juce::File& xmlFile);
+
+    void autoSave();
+
+    void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override { ++configGeneration; }
+    void valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&) override { ++configGeneration; }
+    void valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int) override { ++configGeneration; }
+    void valueTreeChildOrderChanged (juce::ValueTree&, int, int) override { ++configGeneration; }
+    void valueTreeParentChanged (juce::ValueTree&) override { ++configGeneration; }
+
     juce::Component::SafePointer<juce::Component> parent;
 
     MagicGUIBuilder&            builder;
@@ -132,6 +144,11 @@ private:
     PropertiesEditor propertiesEditor { builder };
     Palette          palette { builder };
 
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    PaintProfilerPanel paintProfilerPanel { parent };
+    bool               showPaintProfiler = false;
+#endif
+
     juce::StretchableLayoutManager    resizeManager;
     juce::StretchableLayoutResizerBar resizer1 { &resizeManager, 1, false };
     juce::StretchableLayoutResizerBar resizer3 { &resizeManager, 3, false };
@@ -140,6 +157,12 @@ private:
     juce::File                                  lastLocation;
     juce::File                                  autoSaveFile;
 
+    // the autosave is written from a snapshot in the background, only if the config changed
+    juce::ValueTree  observedConfig;
+    juce::uint64     configGeneration = 0;
+    juce::uint64     autoSavedGeneration = 0;
+    juce::ThreadPool autoSavePool { 1 };
+
     void                           updateToolboxPosition();
     juce::ResizableCornerComponent resizeCorner { this, nullptr };
     juce::ComponentDragger         componentDragger;
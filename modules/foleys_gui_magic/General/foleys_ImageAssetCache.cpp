@@ -0,0 +1,234 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_ImageAssetCache.h"
+
+namespace foleys
+{
+
+ImageAssetCache::ImageAssetCache()
+  : ImageAssetCache (&ImageAssetCache::decode)
+{
+}
+
+ImageAssetCache::ImageAssetCache (Decoder decoderToUse)
+  : decoder (std::move (decoderToUse))
+{
+    statistics.memoryBudget = 128 * 1024 * 1024;
+}
+
+ImageAssetCache::~ImageAssetCache()
+{
+    decoderPool.removeAllJobs (true, 2000);
+}
+
+juce::Image ImageAssetCache::getImage (const juce::String& name)
+{
+    return findOrDecode (name, true);
+}
+
+void ImageAssetCache::preloadImagesReferencedIn (const juce::ValueTree& tree)
+{
+    juce::StringArray names;
+    collectImageNames (tree, Resources::getResourceFileNames(), names);
+
+    for (const auto& name : names)
+    {
+        {
+            const juce::ScopedLock sl (lock);
+            if (entries.find (name) != entries.end())
+                continue;
+        }
+
+        decoderPool.addJob ([this, name] { findOrDecode (name, false); });
+    }
+}
+
+void ImageAssetCache::setMemoryBudget (size_t bytes)
+{
+    const juce::ScopedLock sl (lock);
+    statistics.memoryBudget = bytes;
+    evictIfNeeded();
+}
+
+ImageAssetCache::Statistics ImageAssetCache::getStatistics() const
+{
+    const juce::ScopedLock sl (lock);
+    return statistics;
+}
+
+void ImageAssetCache::clear()
+{
+    const juce::ScopedLock sl (lock);
+    entries.clear();
+    statistics.numImages  = 0;
+    statistics.bytesInUse = 0;
+}
+
+juce::Image ImageAssetCache::findOrDecode (const juce::String& name, bool countStatistics)
+{
+    std::shared_ptr<Pending> pending;
+
+    {
+        const juce::ScopedLock sl (lock);
+
+        auto it = entries.find (name);
+        if (it != entries.end())
+        {
+            if (countStatistics)
+                ++statistics.hits;
+
+            it->second.lastUsed = ++useCounter;
+            return it->second.image;
+        }
+
+        if (countStatistics)
+            ++statistics.misses;
+
+        auto running = decoding.find (name);
+        if (running != decoding.end())
+            pending = running->second;
+        else
+            decoding [name] = std::make_shared<Pending>();
+    }
+
+    if (pending != nullptr)
+    {
+        // another thread, usually the preloader, is decoding this image already
+        pending->finished.wait();
+        return pending->image;
+    }
+
+    auto image = decoder (name);
+    if (image.isValid())
+        insert (name, image);
+
+    std::shared_ptr<Pending> finished;
+
+    {
+        const juce::ScopedLock sl (lock);
+        auto running = decoding.find (name);
+        finished = running->second;
+        decoding.erase (running);
+    }
+
+    finished->image = image;
+    finished->finished.signal();
+    return image;
+}
+
+bool ImageAssetCache::isImageResource (const juce::String& name)
+{
+    int dataSize = 0;
+    const char* data = BinaryData::getNamedResource (name.toRawUTF8(), dataSize);
+    if (data == nullptr)
+        return false;
+
+    // this only reads the header, nothing is decoded
+    juce::MemoryInputStream stream (data, size_t (dataSize), false);
+    return juce::ImageFileFormat::findImageFormatForStream (stream) != nullptr;
+}
+
+juce::Image ImageAssetCache::decode (const juce::String& name)
+{
+    int dataSize = 0;
+    const char* data = BinaryData::getNamedResource (name.toRawUTF8(), dataSize);
+    if (data == nullptr)
+        return {};
+
+    return juce::ImageFileFormat::loadFrom (data, size_t (dataSize));
+}
+
+size_t ImageAssetCache::getNumBytes (const juce::Image& image)
+{
+    const juce::Image::BitmapData bitmap (image, juce::Image::BitmapData::readOnly);
+    return size_t (bitmap.lineStride) * size_t (image.getHeight());
+}
+
+void ImageAssetCache::insert (const juce::String& name, const juce::Image& image)
+{
+    const juce::ScopedLock sl (lock);
+
+    // it might have been decoded by the preloader in the meantime
+    if (entries.find (name) != entries.end())
+        return;
+
+    const auto bytes = getNumBytes (image);
+    entries [name] = { image, bytes, ++useCounter };
+
+    ++statistics.numImages;
+    statistics.bytesInUse += bytes;
+
+    evictIfNeeded();
+}
+
+void ImageAssetCache::evictIfNeeded()
+{
+    while (statistics.bytesInUse > statistics.memoryBudget)
+    {
+        auto oldest = entries.end();
+        for (auto it = entries.begin(); it != entries.end(); ++it)
+        {
+            // images that are still used outside the cache would not free any memory
+            if (it->second.image.getReferenceCount() > 1)
+                continue;
+
+            if (oldest == entries.end() || it->second.lastUsed < oldest->second.lastUsed)
+                oldest = it;
+        }
+
+        if (oldest == entries.end())
+            return;
+
+        statistics.bytesInUse -= oldest->second.bytes;
+        --statistics.numImages;
+        ++statistics.evictions;
+        entries.erase (oldest);
+    }
+}
+
+void ImageAssetCache::collectImageNames (const juce::ValueTree& tree, const juce::StringArray& resources, juce::StringArray& names) const
+{
+    for (int i = 0; i < tree.getNumProperties(); ++i)
+    {
+        const auto& value = tree.getProperty (tree.getPropertyName (i));
+        if (value.isString() && resources.contains (value.toString()) && ! names.contains (value.toString())
+            && isImageResource (value.toString()))
+            names.add (value.toString());
+    }
+
+    for (const auto& child : tree)
+        collectImageNames (child, resources, names);
+}
+
+} // namespace foleys
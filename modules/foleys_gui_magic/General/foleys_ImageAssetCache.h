@@ -0,0 +1,140 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace foleys
+{
+
+/**
+ The ImageAssetCache holds the decoded images from the BinaryData resources, so they are decoded only
+ once per process, no matter how often an editor is opened. It is accessed via SharedImageAssetCache,
+ each MagicGUIState holds a reference so the images stay decoded as long as a plugin instance exists.
+
+ Images not referenced outside the cache are evicted least recently used first, once the decoded
+ images exceed the memory budget.
+ */
+class ImageAssetCache
+{
+public:
+    struct Statistics
+    {
+        int    hits      = 0;
+        int    misses    = 0;
+        int    evictions = 0;
+        int    numImages = 0;
+        size_t bytesInUse   = 0;
+        size_t memoryBudget = 0;
+    };
+
+    using Decoder = std::function<juce::Image (const juce::String& name)>;
+
+    /**
+     Creates a cache for the BinaryData resources
+     */
+    ImageAssetCache();
+
+    /**
+     Creates a cache with a different decoder, e.g. to load images from somewhere else than BinaryData
+     */
+    explicit ImageAssetCache (Decoder decoderToUse);
+
+    ~ImageAssetCache();
+
+    /**
+     Returns the decoded image of a BinaryData resource, decoding it if it is not yet in the cache.
+     If the preloader is decoding it at the moment, this waits for it instead of decoding it twice.
+     */
+    juce::Image getImage (const juce::String& name);
+
+    /**
+     Decodes all images referenced in the tree on a background thread. All property values,
+     that are the name of a BinaryData resource in a known image format, are considered.
+     */
+    void preloadImagesReferencedIn (const juce::ValueTree& tree);
+
+    /**
+     Set the budget for decoded images in bytes. Images still in use are not evicted.
+     */
+    void setMemoryBudget (size_t bytes);
+
+    Statistics getStatistics() const;
+
+    void clear();
+
+private:
+    struct Entry
+    {
+        juce::Image image;
+        size_t      bytes = 0;
+        juce::int64 lastUsed = 0;
+    };
+
+    /**
+     An image being decoded, the waiting threads get the image from here, since it might
+     already be evicted again when they look it up
+     */
+    struct Pending
+    {
+        juce::WaitableEvent finished { true };
+        juce::Image         image;
+    };
+
+    juce::Image findOrDecode (const juce::String& name, bool countStatistics);
+
+    static bool isImageResource (const juce::String& name);
+    static juce::Image decode (const juce::String& name);
+    static size_t getNumBytes (const juce::Image& image);
+
+    void insert (const juce::String& name, const juce::Image& image);
+    void evictIfNeeded();
+    void collectImageNames (const juce::ValueTree& tree, const juce::StringArray& resources, juce::StringArray& names) const;
+
+    const Decoder decoder;
+
+    mutable juce::CriticalSection lock;
+    std::map<juce::String, Entry> entries;
+    std::map<juce::String, std::shared_ptr<Pending>> decoding;
+    juce::int64                   useCounter = 0;
+    Statistics                    statistics;
+
+    juce::ThreadPool decoderPool { 1 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ImageAssetCache)
+};
+
+using SharedImageAssetCache = juce::SharedResourcePointer<ImageAssetCache>;
+
+} // namespace foleys
@@ -39,6 +39,8 @@
 #include "../LookAndFeels/foleys_JuceLookAndFeels.h"
 #include "../LookAndFeels/foleys_LookAndFeel.h"
 #include "../LookAndFeels/foleys_Skeuomorphic.h"
+#include "../Widgets/foleys_MagicLevelMeter.h"
+#include "../Widgets/foleys_MagicPlotComponent.h"
 
 #if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
 #include "../Editor/foleys_ToolBox.h"
@@ -148,7 +150,17 @@ void MagicGUIBuilder::createGUI (juce::Component& parentToUse)
 {
     parent = &parentToUse;
 
-    updateComponents();
+    if (detached && root != nullptr)
+    {
+        detached = false;
+        setVisualisersConsuming (*root, true);
+        parent->addAndMakeVisible (root.get());
+        root->setBounds (parent->getLocalBounds());
+    }
+    else
+    {
+        updateComponents();
+    }
 
 #if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
     if (magicToolBox.get() != nullptr)
@@ -156,12 +168,57 @@ void MagicGUIBuilder::createGUI (juce::Component& parentToUse)
 #endif
 }
 
+void MagicGUIBuilder::detachFromParent()
+{
+    setEditMode (false);
+    overlayDialog.reset();
+
+#if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
+    magicToolBox.reset();
+#endif
+
+    if (parent != nullptr && root != nullptr)
+        parent->removeChildComponent (root.get());
+
+    // nobody sees the cached GUI, so the visualisers must not keep their sources processing
+    if (root != nullptr)
+        setVisualisersConsuming (*root, false);
+
+    parent = nullptr;
+    detached = (root != nullptr);
+}
+
+void MagicGUIBuilder::setVisualisersConsuming (juce::Component& component, bool shouldConsume)
+{
+    if (auto* plot = dynamic_cast<MagicPlotComponent*> (&component))
+        plot->setConsumingSource (shouldConsume);
+    else if (auto* meter = dynamic_cast<MagicLevelMeter*> (&component))
+        meter->setConsumingSource (shouldConsume);
+
+    for (auto* child : component.getChildren())
+        setVisualisersConsuming (*child, shouldConsume);
+}
+
+void MagicGUIBuilder::dropDetachedGUI()
+{
+    if (! detached)
+        return;
+
+    // a detached GUI is outdated now, it will be created fresh when it's attached again
+    detached = false;
+    auto outdated = std::move (root);
+}
+
 void MagicGUIBuilder::updateComponents()
 {
     if (parent == nullptr)
+    {
+        dropDetachedGUI();
         return;
+    }
 
     updateStylesheet();
+    resolveStyles (getGuiRootNode());
 
     root = createGuiItem (getGuiRootNode());
     parent->addAndMakeVisible (root.get());
@@ -170,6 +227,52 @@ void MagicGUIBuilder::updateComponents()
 
     if (root.get() != nullptr)
         root->setEditMode (editMode);
+
+    resolvedStyles.clear();
+}
+
+void MagicGUIBuilder::resolveStyles (const juce::ValueTree& tree)
+{
+    // for small GUIs it is not worth to wake up the threads
+    const int minNumNodesToResolve = 200;
+
+    int numNodes = 0;
+    std::function<void (const juce::ValueTree&)> count = [&] (const juce::ValueTree& node)
+    {
+        ++numNodes;
+        for (const auto& child : node)
+            count (child);
+    };
+    count (tree);
+
+    if (numNodes < minNumNodesToResolve || juce::SystemStats::getNumCpus() < 2)
+        return;
+
+    // the type specific properties need the factories, so they are collected here on the message thread
+    ResolvedStyles::PropertiesPerType properties;
+    properties [IDs::view] = ResolvedStyles::getContainerProperties();
+
+    std::function<void (const juce::ValueTree&)> collect = [&] (const juce::ValueTree& node)
+    {
+        const auto type = node.getType();
+        if (type != IDs::view && properties.find (type) == properties.end() && factories.find (type) != factories.end())
+        {
+            auto& names = properties [type];
+            for (const auto& property : getSettableProperties (type, node))
+                names.addIfNotAlreadyThere (property.name);
+
+            for (const auto& colour : getColourNames (type))
+                names.addIfNotAlreadyThere (colour);
+        }
+
+        for (const auto& child : node)
+            collect (child);
+    };
+    collect (tree);
+
+    // the threads are only needed while building, so they don't idle for the lifetime of the builder
+    juce::ThreadPool pool (juce::SystemStats::getNumCpus() - 1);
+    resolvedStyles.resolve (stylesheet, tree, properties, pool);
 }
 
 void MagicGUIBuilder::updateLayout (juce::Rectangle<int> bounds)
@@ -210,20 +313,53 @@ void MagicGUIBuilder::updateColours()
 
 GuiItem* MagicGUIBuilder::findGuiItemWithId (const juce::String& name)
 {
-    if (root)
-        return root->findGuiItemWithId (name);
+    auto found = itemsById.find (name);
+    if (found != itemsById.end() && ! found->second.empty())
+        return found->second.front();
 
     return nullptr;
 }
 
 GuiItem* MagicGUIBuilder::findGuiItem (const juce::ValueTree& node)
 {
-    if (node.isValid() && root)
-        return root->findGuiItem (node);
+    if (! node.isValid() || root == nullptr)
+        return nullptr;
+
+    auto found = itemsById.find (node.getProperty (IDs::id, juce::String()).toString());
+    if (found != itemsById.end())
+        for (auto* item : found->second)
+            if (item->getNode() == node)
+                return item;
+
+    // nodes without id, or with an id that is not yet re-registered, are found through their parent
+    if (root->getNode() == node)
+        return root.get();
+
+    if (auto* container = dynamic_cast<Container*> (findGuiItem (node.getParent())))
+        return container->findChildItem (node);
 
     return nullptr;
 }
 
+void MagicGUIBuilder::registerGuiItem (GuiItem& item, const juce::String& itemId)
+{
+    if (itemId.isNotEmpty())
+        itemsById[itemId].push_back (&item);
+}
+
+void MagicGUIBuilder::unregisterGuiItem (GuiItem& item, const juce::String& itemId)
+{
+    auto withId = itemsById.find (itemId);
+    if (withId != itemsById.end())
+    {
+        auto& items = withId->second;
+        items.erase (std::remove (items.begin(), items.end(), &item), items.end());
+
+        if (items.empty())
+            itemsById.erase (withId);
+    }
+}
+
 void MagicGUIBuilder::registerFactory (juce::Identifier type, std::unique_ptr<GuiItem> (*factory) (MagicGUIBuilder& builder, const juce::ValueTree&))
 {
     if (factories.find (type) != factories.cend())
@@ -237,14 +373,52 @@ void MagicGUIBuilder::registerFactory (juce::Identifier type, std::unique_ptr<Gu
     factories[type] = factory;
 }
 
+void MagicGUIBuilder::registerFactory (juce::Identifier type, std::unique_ptr<GuiItem> (*factory) (MagicGUIBuilder& builder, const juce::ValueTree&), FactoryMetadata metadata)
+{
+    if (factories.find (type) != factories.cend())
+    {
+        // You tried to add two factories with the same type name!
+        // That cannot work, the second factory will be ignored.
+        jassertfalse;
+        return;
+    }
+
+    factories[type] = factory;
+    factoryMetadata[type] = std::move (metadata);
+}
+
+const MagicGUIBuilder::FactoryMetadata& MagicGUIBuilder::getFactoryMetadata (juce::Identifier type)
+{
+    auto known = factoryMetadata.find (type);
+    if (known != factoryMetadata.end())
+        return known->second;
+
+    // no metadata was registered, so create one item to ask and remember the answer
+    FactoryMetadata metadata;
+
+    juce::ValueTree node (type);
+    if (auto item = createGuiItem (node))
+    {
+        metadata.colourNames = item->getColourNames();
+        metadata.settableProperties = [properties = item->getSettableProperties()] (MagicGUIBuilder&, const juce::ValueTree&)
+        {
+            return properties;
+        };
+    }
+
+    return factoryMetadata[type] = std::move (metadata);
+}
+
 juce::StringArray MagicGUIBuilder::getFactoryNames() const
 {
-    juce::StringArray names { IDs::view.toString() };
+    juce::StringArray names;
 
-    names.ensureStorageAllocated (int (factories.size()));
+    names.ensureStorageAllocated (int (factories.size()) + 1);
     for (const auto& f: factories)
         names.add (f.first.toString());
 
+    names.sort (true);
+    names.insert (0, IDs::view.toString());
     return names;
 }
 
@@ -263,18 +437,34 @@ void MagicGUIBuilder::registerLookAndFeel (juce::String name, std::unique_ptr<ju
     stylesheet.registerLookAndFeel (name, std::move (lookAndFeel));
 }
 
+void MagicGUIBuilder::registerSharedLookAndFeel (juce::String name, LookAndFeelRegistry::Factory factory)
+{
+    if (name.isEmpty())
+    {
+        // A LookAndFeel needs a name to be referenced in the stylesheet
+        jassertfalse;
+        return;
+    }
+
+    stylesheet.registerSharedLookAndFeel (name, lookAndFeelRegistry->getOrCreate (name, factory));
+}
+
 void MagicGUIBuilder::registerJUCELookAndFeels()
 {
-    stylesheet.registerLookAndFeel ("LookAndFeel_V1", std::make_unique<juce::LookAndFeel_V1>());
-    stylesheet.registerLookAndFeel ("LookAndFeel_V2", std::make_unique<JuceLookAndFeel_V2>());
-    stylesheet.registerLookAndFeel ("LookAndFeel_V3", std::make_unique<JuceLookAndFeel_V3>());
-    stylesheet.registerLookAndFeel ("LookAndFeel_V4", std::make_unique<JuceLookAndFeel_V4>());
-    stylesheet.registerLookAndFeel ("FoleysFinest", std::make_unique<LookAndFeel>());
-    stylesheet.registerLookAndFeel ("Skeuomorphic", std::make_unique<Skeuomorphic>());
+    registerSharedLookAndFeel ("LookAndFeel_V1", [] { return std::make_unique<juce::LookAndFeel_V1>(); });
+    registerSharedLookAndFeel ("LookAndFeel_V2", [] { return std::make_unique<JuceLookAndFeel_V2>(); });
+    registerSharedLookAndFeel ("LookAndFeel_V3", [] { return std::make_unique<JuceLookAndFeel_V3>(); });
+    registerSharedLookAndFeel ("LookAndFeel_V4", [] { return std::make_unique<JuceLookAndFeel_V4>(); });
+    registerSharedLookAndFeel ("FoleysFinest", [] { return std::make_unique<LookAndFeel>(); });
+    registerSharedLookAndFeel ("Skeuomorphic", [] { return std::make_unique<Skeuomorphic>(); });
 }
 
 juce::var MagicGUIBuilder::getStyleProperty (const juce::Identifier& name, const juce::ValueTree& node) const
 {
+    if (! resolvedStyles.isEmpty() && resolvedStyles.getStyleGeneration() == stylesheet.getStyleGeneration())
+        if (const auto* resolved = resolvedStyles.find (name, node))
+            return *resolved;
+
     return stylesheet.getStyleProperty (name, node);
 }
 
@@ -295,9 +485,14 @@ void MagicGUIBuilder::removeStyleClassReferences (juce::ValueTree tree, const ju
 
 juce::StringArray MagicGUIBuilder::getColourNames (juce::Identifier type)
 {
-    juce::ValueTree node (type);
-    if (auto item = createGuiItem (node))
-        return item->getColourNames();
+    return getFactoryMetadata (type).colourNames;
+}
+
+std::vector<SettableProperty> MagicGUIBuilder::getSettableProperties (juce::Identifier type, const juce::ValueTree& node)
+{
+    const auto& metadata = getFactoryMetadata (type);
+    if (metadata.settableProperties)
+        return metadata.settableProperties (*this, node);
 
     return {};
 }
@@ -378,6 +573,8 @@ RadioButtonManager& MagicGUIBuilder::getRadioButtonManager()
 
 void MagicGUIBuilder::changeListenerCallback (juce::ChangeBroadcaster*)
 {
+    stylesheet.invalidateStyleCache();
+
     if (root.get() != nullptr)
         root->updateInternal();
 
@@ -390,6 +587,26 @@ void MagicGUIBuilder::valueTreeRedirected (juce::ValueTree& treeWhichHasBeenChan
     updateComponents();
 }
 
+void MagicGUIBuilder::valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&)
+{
+    dropDetachedGUI();
+}
+
+void MagicGUIBuilder::valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&)
+{
+    dropDetachedGUI();
+}
+
+void MagicGUIBuilder::valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int)
+{
+    dropDetachedGUI();
+}
+
+void MagicGUIBuilder::valueTreeChildOrderChanged (juce::ValueTree&, int, int)
+{
+    dropDetachedGUI();
+}
+
 MagicGUIState& MagicGUIBuilder::getMagicState()
 {
     return magicState;
@@ -400,6 +617,11 @@ juce::UndoManager& MagicGUIBuilder::getUndoManager()
     return undo;
 }
 
+void MagicGUIBuilder::setUndoLimits (int maxNumberOfUnitsToKeep, int minimumTransactionsToKeep)
+{
+    undo.setMaxNumberOfStoredUnits (maxNumberOfUnitsToKeep, minimumTransactionsToKeep);
+}
+
 void MagicGUIBuilder::setEditMode (bool shouldEdit)
 {
     editMode = shouldEdit;
@@ -35,6 +35,8 @@
 
 #include "../Layout/foleys_GuiItem.h"
 #include "../Layout/foleys_Stylesheet.h"
+#include "../Layout/foleys_ResolvedStyles.h"
+#include "../LookAndFeels/foleys_LookAndFeelRegistry.h"
 #include "../State/foleys_MagicGUIState.h"
 #include "../State/foleys_RadioButtonManager.h"
 
@@ -66,10 +68,17 @@ public:
     std::unique_ptr<GuiItem> createGuiItem (const juce::ValueTree& node);
 
     /**
-     This triggers the rebuild of the GUI with setting the parent component
+     This triggers the rebuild of the GUI with setting the parent component.
+     If the builder was detached before, the existing components are attached to the new parent instead.
      */
     void createGUI (juce::Component& parent);
 
+    /**
+     Removes the components from the parent, so the builder can outlive its editor, e.g. in the editor
+     cache of the MagicProcessorState. The next call to createGUI will reuse the components.
+     */
+    void detachFromParent();
+
     /**
      Grant access to the stylesheet to look up visual and layout properties
      */
@@ -92,10 +101,18 @@ public:
     GuiItem* findGuiItemWithId (const juce::String& name);
 
     /**
-     Seeks recursively for a GuiItem
+     Returns the GuiItem that was created for that node, if any. Nodes with an id are found through
+     the index, all others through the item of their parent node.
      */
     GuiItem* findGuiItem (const juce::ValueTree& node);
 
+    /**
+     GuiItems add themselves to the id index when created and remove themselves when destroyed,
+     so findGuiItem and findGuiItemWithId don't need to search the tree.
+     */
+    void registerGuiItem (GuiItem& item, const juce::String& itemId);
+    void unregisterGuiItem (GuiItem& item, const juce::String& itemId);
+
     /**
      This selects the stylesheet node and sets it to the Stylesheet.
      If no stylesheet is found, a default one is created.
@@ -124,13 +141,53 @@ public:
      */
     void registerFactory (juce::Identifier type, std::unique_ptr<GuiItem> (*factory) (MagicGUIBuilder& builder, const juce::ValueTree&));
 
+    /**
+     The FactoryMetadata allows the GUI editor to list the settable properties and colours
+     of a type without creating a GuiItem.
+     */
+    struct FactoryMetadata
+    {
+        std::function<std::vector<SettableProperty> (MagicGUIBuilder&, const juce::ValueTree&)> settableProperties;
+        juce::StringArray colourNames;
+    };
+
+    /**
+     Register a factory together with its metadata. Factories registered without metadata
+     are instantiated once, when the editor asks for their properties the first time.
+     */
+    void registerFactory (juce::Identifier type, std::unique_ptr<GuiItem> (*factory) (MagicGUIBuilder& builder, const juce::ValueTree&), FactoryMetadata metadata);
+
+    /**
+     Register a GuiItem, that implements the static methods settableProperties() and
+     colourTranslationTable(), together with its metadata.
+     */
+    template<typename ItemType>
+    void registerFactoryWithMetadata (juce::Identifier type)
+    {
+        FactoryMetadata metadata;
+        metadata.settableProperties = &ItemType::settableProperties;
+
+        for (const auto& pair : ItemType::colourTranslationTable())
+            metadata.colourNames.addIfNotAlreadyThere (pair.first);
+
+        registerFactory (type, &ItemType::factory, std::move (metadata));
+    }
+
     /**
      With that method you can register your custom LookAndFeel class and apply it to different components.
      */
     void registerLookAndFeel (juce::String name, std::unique_ptr<juce::LookAndFeel> lookAndFeel);
 
     /**
-     Registers automatically the JUCE LookAndFeel classes (V1..V4 at the time of writing)
+     Register a LookAndFeel, that is shared with all other editors in the process. The factory is only
+     called when no other editor created that LookAndFeel yet. Use this for LookAndFeels, that don't
+     keep any state of a particular plugin instance.
+     */
+    void registerSharedLookAndFeel (juce::String name, LookAndFeelRegistry::Factory factory);
+
+    /**
+     Registers automatically the JUCE LookAndFeel classes (V1..V4 at the time of writing).
+     These are shared with all other editors in the process.
      */
     void registerJUCELookAndFeels();
 
@@ -158,6 +215,14 @@ public:
      */
     juce::StringArray getColourNames (juce::Identifier type);
 
+    /**
+     This method returns the properties the designer can set for a certain Component type
+
+     @param type the type of the Component
+     @param node the node the properties are set on
+     */
+    std::vector<SettableProperty> getSettableProperties (juce::Identifier type, const juce::ValueTree& node);
+
     /**
      This resets the GUI to show a single empty container
      */
@@ -216,6 +281,15 @@ public:
 
     void valueTreeRedirected (juce::ValueTree& treeWhichHasBeenChanged) override;
 
+    /**
+     Any change to the GUI tree while the GUI is detached outdates the cached components,
+     they are created fresh when the GUI is attached again.
+     */
+    void valueTreePropertyChanged (juce::ValueTree& treeWhosePropertyHasChanged, const juce::Identifier& property) override;
+    void valueTreeChildAdded (juce::ValueTree& parentTree, juce::ValueTree& childWhichHasBeenAdded) override;
+    void valueTreeChildRemoved (juce::ValueTree& parentTree, juce::ValueTree& childWhichHasBeenRemoved, int indexFromWhichChildWasRemoved) override;
+    void valueTreeChildOrderChanged (juce::ValueTree& parentTreeWhoseChildrenHaveMoved, int oldIndex, int newIndex) override;
+
     /**
      Lookup the default value of the property
      */
@@ -225,6 +299,15 @@ public:
 
     juce::UndoManager& getUndoManager();
 
+    /**
+     Limit the memory the undo history of the GUI editor may use. Older transactions are
+     dropped once the limit is reached.
+
+     @param maxNumberOfUnitsToKeep    the size of all actions, each property change counts as 10 units
+     @param minimumTransactionsToKeep the number of transactions kept regardless of their size
+     */
+    void setUndoLimits (int maxNumberOfUnitsToKeep, int minimumTransactionsToKeep);
+
 #if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
     void attachToolboxToWindow (juce::Component& window);
 
@@ -256,6 +339,9 @@ public:
     void draggedItemOnto (juce::ValueTree dropped, juce::ValueTree target, int index = -1);
 
 private:
+    // this needs to outlive all components, since they might use the shared LookAndFeels
+    SharedLookAndFeelRegistry lookAndFeelRegistry;
+
     juce::UndoManager undo;
     Stylesheet        stylesheet { *this };
 
@@ -267,11 +353,36 @@ private:
 
     RadioButtonManager radioButtonManager;
 
+    struct StringHash
+    {
+        size_t operator() (const juce::String& string) const noexcept { return string.hash(); }
+    };
+
+    std::unordered_map<juce::String, std::vector<GuiItem*>, StringHash> itemsById;
+
     std::unique_ptr<GuiItem> root;
+    bool                     detached = false;
+
+    /**
+     Registers or unregisters all plots and meters below the component as consumers of their sources
+     */
+    static void setVisualisersConsuming (juce::Component& component, bool shouldConsume);
+
+    void dropDetachedGUI();
+
+    /**
+     Large GUI trees get their styles resolved in parallel, before the GuiItems are created
+     */
+    void resolveStyles (const juce::ValueTree& tree);
+
+    ResolvedStyles resolvedStyles;
 
     std::unique_ptr<juce::Component> overlayDialog;
 
-    std::map<juce::Identifier, std::unique_ptr<GuiItem> (*) (MagicGUIBuilder& builder, const juce::ValueTree&)> factories;
+    std::unordered_map<juce::Identifier, std::unique_ptr<GuiItem> (*) (MagicGUIBuilder& builder, const juce::ValueTree&), IdentifierHash> factories;
+    std::unordered_map<juce::Identifier, FactoryMetadata, IdentifierHash> factoryMetadata;
+
+    const FactoryMetadata& getFactoryMetadata (juce::Identifier type);
 
     juce::ListenerList<Listener> listeners;
     bool                         editMode = false;
@@ -69,9 +69,9 @@ public:
     static const juce::Identifier  pFilmStrip;
     static const juce::Identifier  pNumImages;
 
-    SliderItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "slider-background", juce::Slider::backgroundColourId },
             { "slider-thumb", juce::Slider::thumbColourId },
@@ -82,7 +82,12 @@ public:
             { "slider-text-background", juce::Slider::textBoxBackgroundColourId },
             { "slider-text-highlight", juce::Slider::textBoxHighlightColourId },
             { "slider-text-outline", juce::Slider::textBoxOutlineColourId }
-        });
+        };
+    }
+
+    SliderItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (slider);
     }
@@ -146,19 +151,24 @@ public:
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
 
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pSliderType, SettableProperty::Choice, pSliderTypes [0], magicBuilder.createChoicesMenuLambda (pSliderTypes) });
-        props.push_back ({ configNode, pSliderTextBox, SettableProperty::Choice, pTextBoxPositions [2], magicBuilder.createChoicesMenuLambda (pTextBoxPositions) });
-        props.push_back ({ configNode, pValue, SettableProperty::Choice, 1.0f, magicBuilder.createPropertiesMenuLambda() });
-        props.push_back ({ configNode, pMinValue, SettableProperty::Number, 0.0f, {} });
-        props.push_back ({ configNode, pMaxValue, SettableProperty::Number, 2.0f, {} });
-        props.push_back ({ configNode, pInterval, SettableProperty::Number, 0.0f, {} });
-        props.push_back ({ configNode, pSuffix, SettableProperty::Text, {}, {} });
-        props.push_back ({ configNode, pFilmStrip, SettableProperty::Choice, 0.0f, magicBuilder.createChoicesMenuLambda(Resources::getResourceFileNames()) });
-        props.push_back ({ configNode, pNumImages, SettableProperty::Number, 0.0f, {} });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pSliderType, SettableProperty::Choice, pSliderTypes [0], builder.createChoicesMenuLambda (pSliderTypes) });
+        props.push_back ({ node, pSliderTextBox, SettableProperty::Choice, pTextBoxPositions [2], builder.createChoicesMenuLambda (pTextBoxPositions) });
+        props.push_back ({ node, pValue, SettableProperty::Choice, 1.0f, builder.createPropertiesMenuLambda() });
+        props.push_back ({ node, pMinValue, SettableProperty::Number, 0.0f, {} });
+        props.push_back ({ node, pMaxValue, SettableProperty::Number, 2.0f, {} });
+        props.push_back ({ node, pInterval, SettableProperty::Number, 0.0f, {} });
+        props.push_back ({ node, pSuffix, SettableProperty::Text, {}, {} });
+        props.push_back ({ node, pFilmStrip, SettableProperty::Choice, 0.0f, builder.createChoicesMenuLambda(Resources::getResourceFileNames()) });
+        props.push_back ({ node, pNumImages, SettableProperty::Number, 0.0f, {} });
 
         return props;
     }
@@ -199,9 +209,9 @@ class ComboBoxItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (ComboBoxItem)
 
-    ComboBoxItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "combo-background", juce::ComboBox::backgroundColourId },
             { "combo-text", juce::ComboBox::textColourId },
@@ -213,7 +223,12 @@ public:
             { "combo-menu-background-highlight", juce::PopupMenu::highlightedBackgroundColourId },
             { "combo-menu-text", juce::PopupMenu::textColourId },
             { "combo-menu-text-highlight", juce::PopupMenu::highlightedTextColourId }
-        });
+        };
+    }
+
+    ComboBoxItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (comboBox);
     }
@@ -235,9 +250,14 @@ public:
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
         return props;
     }
 
@@ -264,15 +284,20 @@ public:
     static const juce::Identifier pProperty;
     static const juce::Identifier pOnClick;
 
-    TextButtonItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "button-color", juce::TextButton::buttonColourId },
             { "button-on-color", juce::TextButton::buttonOnColourId },
             { "button-off-text", juce::TextButton::textColourOffId },
             { "button-on-text", juce::TextButton::textColourOnId }
-        });
+        };
+    }
+
+    TextButtonItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (button);
     }
@@ -324,15 +349,20 @@ public:
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
 
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pText, SettableProperty::Text, {}, {} });
-        props.push_back ({ configNode, pProperty, SettableProperty::Choice, {}, magicBuilder.createPropertiesMenuLambda() });
-        props.push_back ({ configNode, pOnClick, SettableProperty::Choice, {}, magicBuilder.createTriggerMenuLambda() });
-        props.push_back ({ configNode, IDs::buttonRadioGroup, SettableProperty::Number, {}, {} });
-        props.push_back ({ configNode, IDs::buttonRadioValue, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pText, SettableProperty::Text, {}, {} });
+        props.push_back ({ node, pProperty, SettableProperty::Choice, {}, builder.createPropertiesMenuLambda() });
+        props.push_back ({ node, pOnClick, SettableProperty::Choice, {}, builder.createTriggerMenuLambda() });
+        props.push_back ({ node, IDs::buttonRadioGroup, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, IDs::buttonRadioValue, SettableProperty::Number, {}, {} });
 
         return props;
     }
@@ -366,14 +396,19 @@ public:
     static const juce::Identifier pText;
     static const juce::Identifier pProperty;
 
-    ToggleButtonItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "toggle-text", juce::ToggleButton::textColourId },
             { "toggle-tick", juce::ToggleButton::tickColourId },
             { "toggle-tick-disabled", juce::ToggleButton::tickDisabledColourId }
-        });
+        };
+    }
+
+    ToggleButtonItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (button);
     }
@@ -406,13 +441,18 @@ public:
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, pText, SettableProperty::Text, {}, {} });
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pProperty, SettableProperty::Choice, {}, magicBuilder.createPropertiesMenuLambda() });
-        props.push_back ({ configNode, IDs::buttonRadioGroup, SettableProperty::Number, {}, {} });
-        props.push_back ({ configNode, IDs::buttonRadioValue, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, pText, SettableProperty::Text, {}, {} });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pProperty, SettableProperty::Choice, {}, builder.createPropertiesMenuLambda() });
+        props.push_back ({ node, IDs::buttonRadioGroup, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, IDs::buttonRadioValue, SettableProperty::Number, {}, {} });
         return props;
     }
 
@@ -445,9 +485,9 @@ public:
     static const juce::Identifier  pEditable;
     static const juce::Identifier  pValue;
 
-    LabelItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "label-background",         juce::Label::backgroundColourId },
             { "label-outline",            juce::Label::outlineColourId },
@@ -455,7 +495,12 @@ public:
             { "label-editing-background", juce::Label::backgroundWhenEditingColourId },
             { "label-editing-outline",    juce::Label::outlineWhenEditingColourId },
             { "label-editing-text",       juce::Label::textWhenEditingColourId }
-        });
+        };
+    }
+
+    LabelItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (label);
     }
@@ -505,14 +550,19 @@ public:
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, pText, SettableProperty::Text, {}, {} });
-        props.push_back ({ configNode, pJustification, SettableProperty::Choice, {}, magicBuilder.createChoicesMenuLambda (getAllKeyNames (makeJustificationsChoices())) });
-        props.push_back ({ configNode, pFontSize, SettableProperty::Number, {}, {} });
-        props.push_back ({ configNode, pEditable, SettableProperty::Toggle, {}, {} });
-        props.push_back ({ configNode, IDs::parameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pValue, SettableProperty::Choice, {}, magicBuilder.createPropertiesMenuLambda() });
+        props.push_back ({ node, pText, SettableProperty::Text, {}, {} });
+        props.push_back ({ node, pJustification, SettableProperty::Choice, {}, builder.createChoicesMenuLambda (getAllKeyNames (makeJustificationsChoices())) });
+        props.push_back ({ node, pFontSize, SettableProperty::Number, {}, {} });
+        props.push_back ({ node, pEditable, SettableProperty::Toggle, {}, {} });
+        props.push_back ({ node, IDs::parameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pValue, SettableProperty::Choice, {}, builder.createPropertiesMenuLambda() });
         return props;
     }
 
@@ -542,39 +592,64 @@ public:
 
     static const juce::Identifier  pDecay;
     static const juce::Identifier  pGradient;
+    static const juce::Identifier  pBackgroundPaths;
+    static const juce::Identifier  pOpenGL;
 
-    PlotItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "plot-color", MagicPlotComponent::plotColourId },
             { "plot-fill-color", MagicPlotComponent::plotFillColourId },
             { "plot-inactive-color", MagicPlotComponent::plotInactiveColourId },
-            { "plot-inactive-fill-color", MagicPlotComponent::plotInactiveFillColourId }
-        });
+            { "plot-inactive-fill-color", MagicPlotComponent::plotInactiveFillColourId },
+            { "plot-background-color", MagicPlotComponent::plotBackgroundColourId }
+        };
+    }
+
+    PlotItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (plot);
     }
 
     void update() override
     {
+        MagicPlotSource* source = nullptr;
+
         auto sourceID = configNode.getProperty (IDs::source, juce::String()).toString();
         if (sourceID.isNotEmpty())
-            plot.setPlotSource (getMagicState().getObjectWithType<MagicPlotSource>(sourceID));
+        {
+            source = getMagicState().getObjectWithType<MagicPlotSource>(sourceID);
+            plot.setPlotSource (source);
+        }
+
+        // all plots of a source share its builder, so the paths are created one after another
+        plot.setPathBuilder (source != nullptr && getProperty (pBackgroundPaths) ? &getMagicState().getPlotPathBuilder (*source) : nullptr);
 
         auto decay = float (getProperty (pDecay));
         plot.setDecayFactor (decay);
 
         auto gradient = configNode.getProperty (pGradient, juce::String()).toString();
         plot.setGradientFromString (gradient, magicBuilder.getStylesheet());
+
+        plot.setUseOpenGL (getProperty (pOpenGL));
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, IDs::source, SettableProperty::Choice, {}, magicBuilder.createObjectsMenuLambda<MagicPlotSource>() });
-        props.push_back ({ configNode, pDecay,      SettableProperty::Number, {}, {} });
-        props.push_back ({ configNode, pGradient,   SettableProperty::Gradient, {}, {} });
+        props.push_back ({ node, IDs::source, SettableProperty::Choice, {}, builder.createObjectsMenuLambda<MagicPlotSource>() });
+        props.push_back ({ node, pDecay,      SettableProperty::Number, {}, {} });
+        props.push_back ({ node, pGradient,   SettableProperty::Gradient, {}, {} });
+        props.push_back ({ node, pBackgroundPaths, SettableProperty::Toggle, {}, {} });
+        props.push_back ({ node, pOpenGL,     SettableProperty::Toggle, {}, {} });
         return props;
     }
 
@@ -590,6 +665,8 @@ private:
 };
 const juce::Identifier  PlotItem::pDecay    {"plot-decay"};
 const juce::Identifier  PlotItem::pGradient {"plot-gradient"};
+const juce::Identifier  PlotItem::pBackgroundPaths {"plot-background-paths"};
+const juce::Identifier  PlotItem::pOpenGL   {"plot-opengl"};
 
 //==============================================================================
 
@@ -606,10 +683,9 @@ public:
     static const juce::Identifier  pSenseFactor;
     static const juce::Identifier  pJumpToClick;
 
-    XYDraggerItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
-      : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "xy-drag-handle",      XYDragComponent::xyDotColourId },
             { "xy-drag-handle-over", XYDragComponent::xyDotOverColourId },
@@ -617,7 +693,13 @@ public:
             { "xy-horizontal-over",  XYDragComponent::xyHorizontalOverColourId },
             { "xy-vertical",         XYDragComponent::xyVerticalColourId },
             { "xy-vertical-over",    XYDragComponent::xyVerticalOverColourId }
-        });
+        };
+    }
+
+    XYDraggerItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
+      : GuiItem (builder, node)
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (dragger);
     }
@@ -668,17 +750,22 @@ public:
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
 
-        props.push_back ({ configNode, IDs::parameterX, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, IDs::parameterY, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pContextParameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pWheelParameter, SettableProperty::Choice, {}, magicBuilder.createParameterMenuLambda() });
-        props.push_back ({ configNode, pCrosshair, SettableProperty::Choice, {}, magicBuilder.createChoicesMenuLambda (pCrosshairTypes) });
-        props.push_back ({ configNode, pRadius, SettableProperty::Number, {}, {}});
-        props.push_back ({ configNode, pSenseFactor, SettableProperty::Number, {}, {}});
-        props.push_back ({ configNode, pJumpToClick, SettableProperty::Toggle, {}, {}});
+        props.push_back ({ node, IDs::parameterX, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, IDs::parameterY, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pContextParameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pWheelParameter, SettableProperty::Choice, {}, builder.createParameterMenuLambda() });
+        props.push_back ({ node, pCrosshair, SettableProperty::Choice, {}, builder.createChoicesMenuLambda (pCrosshairTypes) });
+        props.push_back ({ node, pRadius, SettableProperty::Number, {}, {}});
+        props.push_back ({ node, pSenseFactor, SettableProperty::Number, {}, {}});
+        props.push_back ({ node, pJumpToClick, SettableProperty::Toggle, {}, {}});
 
         return props;
     }
@@ -708,18 +795,23 @@ class KeyboardItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (KeyboardItem)
 
-    KeyboardItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
-      : GuiItem (builder, node),
-        keyboard (getMagicState().getKeyboardState(), juce::MidiKeyboardComponent::horizontalKeyboard)
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "white-note-color",      juce::MidiKeyboardComponent::whiteNoteColourId },
             { "black-note-color",      juce::MidiKeyboardComponent::blackNoteColourId },
             { "key-separator-line-color", juce::MidiKeyboardComponent::keySeparatorLineColourId },
             { "mouse-over-color",      juce::MidiKeyboardComponent::mouseOverKeyOverlayColourId },
-            { "key-down-color",        juce::MidiKeyboardComponent::keyDownOverlayColourId },
-        });
+            { "key-down-color",        juce::MidiKeyboardComponent::keyDownOverlayColourId }
+        };
+    }
+
+    KeyboardItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
+      : GuiItem (builder, node),
+        keyboard (getMagicState().getKeyboardState(), juce::MidiKeyboardComponent::horizontalKeyboard)
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (keyboard);
     }
@@ -760,19 +852,24 @@ public:
 
     FOLEYS_DECLARE_GUI_FACTORY (DrumpadItem)
 
-    DrumpadItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
-      : GuiItem (builder, node),
-        drumpad (getMagicState().getKeyboardState())
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "drumpad-background",   MidiDrumpadComponent::background },
             { "drumpad-fill",         MidiDrumpadComponent::padFill },
             { "drumpad-outline",      MidiDrumpadComponent::padOutline },
             { "drumpad-down-fill",    MidiDrumpadComponent::padDownFill },
             { "drumpad-down-outline", MidiDrumpadComponent::padDownOutline },
-            { "drumpad-touch",        MidiDrumpadComponent::touch },
-        });
+            { "drumpad-touch",        MidiDrumpadComponent::touch }
+        };
+    }
+
+    DrumpadItem (MagicGUIBuilder& builder, const juce::ValueTree& node)
+      : GuiItem (builder, node),
+        drumpad (getMagicState().getKeyboardState())
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (drumpad);
     }
@@ -793,11 +890,16 @@ public:
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder&, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, pColumns,  SettableProperty::Number,  3, {}});
-        props.push_back ({ configNode, pRows,     SettableProperty::Number,  3, {}});
-        props.push_back ({ configNode, pRootNote, SettableProperty::Number, 64, {}});
+        props.push_back ({ node, pColumns,  SettableProperty::Number,  3, {}});
+        props.push_back ({ node, pRows,     SettableProperty::Number,  3, {}});
+        props.push_back ({ node, pRootNote, SettableProperty::Number, 64, {}});
         return props;
     }
 
@@ -822,16 +924,21 @@ class LevelMeterItem : public GuiItem
 public:
     FOLEYS_DECLARE_GUI_FACTORY (LevelMeterItem)
 
-    LevelMeterItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable()
     {
-        setColourTranslation (
+        return
         {
             { "background-color", MagicLevelMeter::backgroundColourId },
             { "bar-background-color", MagicLevelMeter::barBackgroundColourId },
             { "outline-color", MagicLevelMeter::outlineColourId },
             { "bar-fill-color", MagicLevelMeter::barFillColourId },
-            { "tickmark-color", MagicLevelMeter::tickmarkColourId },
-        });
+            { "tickmark-color", MagicLevelMeter::tickmarkColourId }
+        };
+    }
+
+    LevelMeterItem (MagicGUIBuilder& builder, const juce::ValueTree& node) : GuiItem (builder, node)
+    {
+        setColourTranslation (colourTranslationTable());
 
         addAndMakeVisible (meter);
     }
@@ -844,9 +951,14 @@ public:
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, IDs::source, SettableProperty::Choice, {}, magicBuilder.createObjectsMenuLambda<MagicLevelSource>() });
+        props.push_back ({ node, IDs::source, SettableProperty::Choice, {}, builder.createObjectsMenuLambda<MagicLevelSource>() });
         return props;
     }
 
@@ -930,9 +1042,14 @@ public:
     }
 
     std::vector<SettableProperty> getSettableProperties() const override
+    {
+        return settableProperties (magicBuilder, configNode);
+    }
+
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder& builder, const juce::ValueTree& node)
     {
         std::vector<SettableProperty> props;
-        props.push_back ({ configNode, "list-box-model", SettableProperty::Choice, {}, magicBuilder.createObjectsMenuLambda<juce::ListBoxModel>() });
+        props.push_back ({ node, "list-box-model", SettableProperty::Choice, {}, builder.createObjectsMenuLambda<juce::ListBoxModel>() });
         return props;
     }
 
@@ -984,21 +1101,21 @@ private:
 
 void MagicGUIBuilder::registerJUCEFactories()
 {
-    registerFactory (IDs::slider, &SliderItem::factory);
-    registerFactory (IDs::comboBox, &ComboBoxItem::factory);
-    registerFactory (IDs::textButton, &TextButtonItem::factory);
-    registerFactory (IDs::toggleButton, &ToggleButtonItem::factory);
-    registerFactory (IDs::label, &LabelItem::factory);
-    registerFactory (IDs::plot, &PlotItem::factory);
-    registerFactory (IDs::xyDragComponent, &XYDraggerItem::factory);
-    registerFactory (IDs::keyboardComponent, &KeyboardItem::factory);
-    registerFactory (IDs::drumpadComponent, &DrumpadItem::factory);
-    registerFactory (IDs::meter, &LevelMeterItem::factory);
-    registerFactory ("MidiLearn", &MidiLearnItem::factory);
-    registerFactory (IDs::listBox, &ListBoxItem::factory);
+    registerFactoryWithMetadata<SliderItem> (IDs::slider);
+    registerFactoryWithMetadata<ComboBoxItem> (IDs::comboBox);
+    registerFactoryWithMetadata<TextButtonItem> (IDs::textButton);
+    registerFactoryWithMetadata<ToggleButtonItem> (IDs::toggleButton);
+    registerFactoryWithMetadata<LabelItem> (IDs::label);
+    registerFactoryWithMetadata<PlotItem> (IDs::plot);
+    registerFactoryWithMetadata<XYDraggerItem> (IDs::xyDragComponent);
+    registerFactoryWithMetadata<KeyboardItem> (IDs::keyboardComponent);
+    registerFactoryWithMetadata<DrumpadItem> (IDs::drumpadComponent);
+    registerFactoryWithMetadata<LevelMeterItem> (IDs::meter);
+    registerFactoryWithMetadata<MidiLearnItem> ("MidiLearn");
+    registerFactoryWithMetadata<ListBoxItem> (IDs::listBox);
 
 #if JUCE_MODULE_AVAILABLE_juce_gui_extra && JUCE_WEB_BROWSER
-    registerFactory (IDs::webBrowser, &WebBrowserItem::factory);
+    registerFactoryWithMetadata<WebBrowserItem> (IDs::webBrowser);
 #endif // JUCE_WEB_BROWSER
 }
 
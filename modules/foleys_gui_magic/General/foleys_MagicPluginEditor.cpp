@@ -44,6 +44,8 @@ MagicPluginEditor::MagicPluginEditor (MagicProcessorState& stateToUse, std::uniq
     builder (std::move (builderToUse))
 {
 #if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
+    oglContext.setRenderer (&plotRenderer);
+    oglContext.setComponentPaintingEnabled (true);
     oglContext.attachTo (*this);
 #endif
 
@@ -70,9 +72,17 @@ MagicPluginEditor::MagicPluginEditor (MagicProcessorState& stateToUse, std::uniq
 
 MagicPluginEditor::~MagicPluginEditor()
 {
+    processorState.setEditorVisible (false);
+
 #if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
     oglContext.detach();
 #endif
+
+    if (processorState.getEditorCacheTimeout() > 0)
+    {
+        builder->detachFromParent();
+        processorState.cacheGUIBuilder (std::move (builder));
+    }
 }
 
 void MagicPluginEditor::updateSize()
@@ -144,7 +154,21 @@ void MagicPluginEditor::resized()
 {
     builder->updateLayout (getLocalBounds());
 
+#if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
+    plotRenderer.setViewSize (getWidth(), getHeight());
+#endif
+
     processorState.setLastEditorSize (getWidth(), getHeight());
 }
 
+void MagicPluginEditor::visibilityChanged()
+{
+    processorState.setEditorVisible (isShowing());
+}
+
+void MagicPluginEditor::parentHierarchyChanged()
+{
+    processorState.setEditorVisible (isShowing());
+}
+
 } // namespace foleys
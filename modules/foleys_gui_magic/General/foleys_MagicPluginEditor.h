@@ -73,6 +73,16 @@ public:
 
     void resized() override;
 
+    void visibilityChanged() override;
+    void parentHierarchyChanged() override;
+
+#if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
+    /**
+     Grants access to the renderer, that draws MagicPlotComponents natively in OpenGL
+     */
+    MagicPlotGLRenderer& getPlotRenderer() { return plotRenderer; }
+#endif
+
 private:
 
     /**
@@ -82,6 +92,7 @@ private:
 
 #if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
     juce::OpenGLContext oglContext;
+    MagicPlotGLRenderer plotRenderer;
 #endif
 
     MagicProcessorState& processorState;
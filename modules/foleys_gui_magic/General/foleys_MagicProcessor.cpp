@@ -88,6 +88,9 @@ juce::AudioProcessorEditor* MagicProcessor::createEditor()
 {
     magicState.updateParameterMap();
 
+    if (auto cached = magicState.takeCachedGUIBuilder())
+        return new MagicPluginEditor (magicState, std::move (cached));
+
     auto builder = std::make_unique<MagicGUIBuilder>(magicState);
     initialiseBuilder (*builder);
 
@@ -0,0 +1,129 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_PaintProfiler.h"
+
+namespace foleys
+{
+
+void PaintProfiler::setEnabled (bool shouldRecord)
+{
+    enabled = shouldRecord;
+    running.clear();
+}
+
+void PaintProfiler::reset()
+{
+    entries.clear();
+}
+
+juce::int64 PaintProfiler::startPaint (const juce::Component& component)
+{
+    if (! enabled || &component == ignored)
+        return 0;
+
+    const auto ticks = juce::Time::getHighResolutionTicks();
+    running.push_back ({ ticks, 0 });
+    return ticks;
+}
+
+void PaintProfiler::addPaint (juce::Component& component, const juce::String& name, juce::int64 startTicks, juce::Rectangle<int> clip)
+{
+    if (! enabled || startTicks == 0 || &component == ignored)
+        return;
+
+    auto paint = std::find_if (running.rbegin(), running.rend(), [startTicks] (const auto& r) { return r.startTicks == startTicks; });
+    if (paint == running.rend())
+        return;
+
+    const auto ticks       = juce::Time::getHighResolutionTicks() - startTicks;
+    const auto nestedTicks = paint->nestedTicks;
+
+    // paints that didn't finish are dropped together with this one
+    running.erase (std::next (paint).base(), running.end());
+
+    if (! running.empty())
+        running.back().nestedTicks += ticks;
+
+    const auto milliseconds     = 1000.0 * juce::Time::highResolutionTicksToSeconds (ticks);
+    const auto selfMilliseconds = 1000.0 * juce::Time::highResolutionTicksToSeconds (ticks - nestedTicks);
+
+    auto& entry = entries [&component];
+    if (entry.component == nullptr)
+    {
+        entry.component = &component;
+        entry.name      = name;
+    }
+
+    entry.numPaints++;
+    entry.totalMilliseconds += milliseconds;
+    entry.selfMilliseconds  += selfMilliseconds;
+    entry.maxMilliseconds    = std::max (entry.maxMilliseconds, milliseconds);
+    entry.paintedArea       += juce::int64 (clip.getWidth()) * clip.getHeight();
+}
+
+void PaintProfiler::removeComponent (const juce::Component* component)
+{
+    entries.erase (component);
+}
+
+PaintProfiler::ScopedPaint::ScopedPaint (PaintProfiler& profilerToUse, juce::Component& componentToMeasure, const juce::Graphics& g, const juce::String& nameToUse)
+  : profiler (profilerToUse),
+    component (componentToMeasure),
+    clip (g.getClipBounds()),
+    name (nameToUse),
+    startTicks (profiler.startPaint (componentToMeasure))
+{
+}
+
+PaintProfiler::ScopedPaint::~ScopedPaint()
+{
+    profiler.addPaint (component, name, startTicks, clip);
+}
+
+//==============================================================================
+
+std::vector<PaintProfiler::Entry> PaintProfiler::getEntries() const
+{
+    std::vector<Entry> list;
+    list.reserve (entries.size());
+
+    for (const auto& entry : entries)
+        if (entry.second.component != nullptr)
+            list.push_back (entry.second);
+
+    std::sort (list.begin(), list.end(), [] (const auto& a, const auto& b) { return a.selfMilliseconds > b.selfMilliseconds; });
+    return list;
+}
+
+} // namespace foleys
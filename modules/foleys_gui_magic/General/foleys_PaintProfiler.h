@@ -0,0 +1,144 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace foleys
+{
+
+/**
+ The PaintProfiler collects how long GuiItems and MagicPlotComponents take to paint,
+ how often they were repainted and how many pixels were invalidated. It is only
+ compiled in with FOLEYS_ENABLE_PAINT_PROFILER and records only while enabled.
+
+ The times of a GuiItem are measured from paint() to paintOverChildren(), so the total
+ includes the wrapped component and, for containers, all nested items. The self time
+ excludes the time of nested measurements, so it shows which item itself is expensive.
+ All methods are meant to be called on the message thread.
+ */
+class PaintProfiler
+{
+public:
+    struct Entry
+    {
+        juce::String                                  name;
+        juce::Component::SafePointer<juce::Component> component;
+        int                                           numPaints = 0;
+        double                                        totalMilliseconds = 0.0;
+        double                                        selfMilliseconds = 0.0;
+        double                                        maxMilliseconds = 0.0;
+        juce::int64                                   paintedArea = 0;
+    };
+
+    /**
+     Measures the time from construction to destruction as one paint call
+     */
+    class ScopedPaint
+    {
+    public:
+        ScopedPaint (PaintProfiler& profiler, juce::Component& component, const juce::Graphics& g, const juce::String& name);
+        ~ScopedPaint();
+
+    private:
+        PaintProfiler&       profiler;
+        juce::Component&     component;
+        juce::Rectangle<int> clip;
+        juce::String         name;
+        juce::int64          startTicks = 0;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedPaint)
+    };
+
+    PaintProfiler() = default;
+
+    void setEnabled (bool shouldRecord);
+    bool isEnabled() const { return enabled; }
+
+    /**
+     Paints of this component are not measured, e.g. an overlay showing the measurements.
+     Recording of all other components continues.
+     */
+    void setIgnoredComponent (const juce::Component* componentToIgnore) { ignored = componentToIgnore; }
+
+    /**
+     Forget all measurements
+     */
+    void reset();
+
+    /**
+     Returns the ticks to hand back into addPaint(), or 0 if the profiler is disabled or the
+     component is ignored. Each started paint must be finished with addPaint(), so nested paints
+     can be subtracted.
+     */
+    juce::int64 startPaint (const juce::Component& component);
+
+    /**
+     Add the measurement of one paint call
+
+     @param component  the component that painted
+     @param name       a readable name for the component
+     @param startTicks the value returned from startPaint()
+     @param clip       the clip bounds of the Graphics, i.e. the invalidated area
+     */
+    void addPaint (juce::Component& component, const juce::String& name, juce::int64 startTicks, juce::Rectangle<int> clip);
+
+    /**
+     Call this when a measured component is deleted
+     */
+    void removeComponent (const juce::Component* component);
+
+    /**
+     Returns all measurements, the highest self time first
+     */
+    std::vector<Entry> getEntries() const;
+
+private:
+    struct RunningPaint
+    {
+        juce::int64 startTicks = 0;
+        juce::int64 nestedTicks = 0;
+    };
+
+    std::map<const juce::Component*, Entry> entries;
+    std::vector<RunningPaint>               running;
+    const juce::Component*                  ignored = nullptr;
+    bool                                    enabled = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PaintProfiler)
+};
+
+using SharedPaintProfiler = juce::SharedResourcePointer<PaintProfiler>;
+
+} // namespace foleys
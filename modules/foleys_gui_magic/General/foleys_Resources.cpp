@@ -32,6 +32,7 @@
  */
 
 #include "foleys_Resources.h"
+#include "foleys_ImageAssetCache.h"
 
 namespace BinaryDataFallbacks {
 const int namedResourceListSize = 0;
@@ -60,10 +61,11 @@ juce::Image Resources::getImage (const juce::String& name)
 {
     int dataSize = 0;
     const char* data = BinaryData::getNamedResource (name.toRawUTF8(), dataSize);
-    if (data != nullptr)
-        return juce::ImageCache::getFromMemory (data, dataSize);
+    if (data == nullptr)
+        return {};
 
-    return {};
+    SharedImageAssetCache cache;
+    return cache->getImage (name);
 }
 
 }
@@ -47,7 +47,7 @@ namespace Resources
     static inline juce::StringArray getResourceFileNames();
 
     /**
-     Loads an image from BinaryData via ImageCache
+     Loads an image from BinaryData via the shared ImageAssetCache
 
      @param name is the filename as it appears in the BinaryData (the dot is replaced as underscore)
      */
@@ -143,6 +143,7 @@ namespace IDs
     static juce::String     imageStretch        { "stretch" };
 
     static juce::Identifier backgroundGradient  { "background-gradient" };
+    static juce::Identifier cacheBackground     { "cache-background" };
 
     static juce::Identifier flexDirection       { "flex-direction" };
     static juce::String     flexDirRow          { "row" };
@@ -191,6 +192,19 @@ namespace IDs
 
     static juce::Identifier properties  { "Properties" };
     static juce::Identifier lastSize    { "last-size" };
+
+    static juce::Identifier playhead            { "playhead" };
+    static juce::Identifier bpm                 { "bpm" };
+    static juce::Identifier timeInSeconds       { "timeInSeconds" };
+    static juce::Identifier ppqPosition         { "ppqPosition" };
+    static juce::Identifier ppqLastBarStart     { "ppqLastBarStart" };
+    static juce::Identifier ppqLoopStart        { "ppqLoopStart" };
+    static juce::Identifier ppqLoopEnd          { "ppqLoopEnd" };
+    static juce::Identifier timeSigNumerator    { "timeSigNumerator" };
+    static juce::Identifier timeSigDenominator  { "timeSigDenominator" };
+    static juce::Identifier isPlaying           { "isPlaying" };
+    static juce::Identifier isRecording         { "isRecording" };
+    static juce::Identifier isLooping           { "isLooping" };
 }
 
 } // namespace foleys
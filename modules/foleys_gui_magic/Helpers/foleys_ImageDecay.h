@@ -0,0 +1,108 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+
+namespace foleys
+{
+
+/**
+ Returns the 8 bit fixed point factor decayImage() multiplies with. It is at most 255 for any
+ decay below 1, so the pixels always fade out eventually, even if the decay rounds up to 1.
+ */
+inline std::uint32_t getDecayFactor (float decay)
+{
+    if (decay >= 1.0f)
+        return 256;
+
+    return static_cast<std::uint32_t> (juce::jlimit (0, 255, juce::roundToInt (decay * 256.0f)));
+}
+
+/**
+ Returns the number of decayImage() calls, after which a fully opaque pixel is transparent.
+ */
+inline int getNumDecayFrames (float decay)
+{
+    const auto factor = getDecayFactor (decay);
+    if (factor >= 256)
+        return 0;
+
+    int numFrames = 0;
+    for (std::uint32_t value = 255; value > 0; value = (value * factor) >> 8)
+        ++numFrames;
+
+    return numFrames;
+}
+
+/**
+ Fades an area of an ARGB image by a factor. Since the pixels are premultiplied, all four channels
+ are scaled, two channels at a time in one 32 bit multiply. The loop has no branches, so the
+ compiler can vectorise it. This is much cheaper than juce::Image::multiplyAllAlphas, and it
+ only touches the given area.
+
+ @param image the image to fade, needs to be juce::Image::ARGB
+ @param area  the area to fade, pixels outside are left untouched
+ @param decay the factor to multiply each pixel with, between 0 and 1
+ */
+inline void decayImage (juce::Image& image, juce::Rectangle<int> area, float decay)
+{
+    // this only works on premultiplied ARGB pixels
+    jassert (image.getFormat() == juce::Image::ARGB);
+
+    area = area.getIntersection (image.getBounds());
+    if (area.isEmpty())
+        return;
+
+    const auto factor = getDecayFactor (decay);
+    if (factor >= 256)
+        return;
+
+    juce::Image::BitmapData data (image, area.getX(), area.getY(), area.getWidth(), area.getHeight(), juce::Image::BitmapData::readWrite);
+
+    for (int y = 0; y < data.height; ++y)
+    {
+        auto* pixel = reinterpret_cast<std::uint32_t*> (data.getLinePointer (y));
+
+        for (int x = 0; x < data.width; ++x)
+        {
+            const auto p  = pixel [x];
+            const auto rb = (((p & 0x00ff00ffu) * factor) >> 8) & 0x00ff00ffu;
+            const auto ag = (((p >> 8) & 0x00ff00ffu) * factor) & 0xff00ff00u;
+            pixel [x] = rb | ag;
+        }
+    }
+}
+
+} // namespace foleys
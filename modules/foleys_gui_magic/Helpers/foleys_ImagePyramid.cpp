@@ -0,0 +1,266 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_ImagePyramid.h"
+
+namespace foleys
+{
+
+/**
+ The mip levels of each frame of one source image, and the scaled frames currently in use
+ */
+struct ImagePyramid::Levels
+{
+    Levels (const juce::Image& sourceToUse, int numFramesToUse, bool horizontalFrames)
+      : source (sourceToUse), numFrames (numFramesToUse), horizontal (horizontalFrames)
+    {
+        const auto frameWidth  = horizontal ? source.getWidth() / numFrames : source.getWidth();
+        const auto frameHeight = horizontal ? source.getHeight() : source.getHeight() / numFrames;
+
+        // the clipped images share the pixels of the source
+        for (int i = 0; i < numFrames; ++i)
+        {
+            const auto area = horizontal ? juce::Rectangle<int> (i * frameWidth, 0, frameWidth, frameHeight)
+                                         : juce::Rectangle<int> (0, i * frameHeight, frameWidth, frameHeight);
+            frameLevels.push_back ({ source.getClippedImage (area) });
+        }
+    }
+
+    std::shared_ptr<const ScaledFrames> findScaledFrames (int width, int height)
+    {
+        auto existing = scaled.find ({ width, height });
+        return existing != scaled.end() ? existing->second.lock() : nullptr;
+    }
+
+    std::shared_ptr<const ScaledFrames> getScaledFrames (int width, int height)
+    {
+        if (auto existing = findScaledFrames (width, height))
+            return existing;
+
+        auto frames = std::make_shared<ScaledFrames>();
+
+        for (auto& mipLevels : frameLevels)
+        {
+            const auto& original = mipLevels.front();
+            const auto  index = size_t (getLevelIndex (original.getWidth(), original.getHeight(), width, height));
+
+            while (mipLevels.size() <= index)
+            {
+                const auto& last = mipLevels.back();
+                mipLevels.push_back (last.rescaled (last.getWidth() / 2, last.getHeight() / 2, juce::Graphics::mediumResamplingQuality));
+            }
+
+            const auto& level = mipLevels [index];
+            frames->push_back ((level.getWidth() == width && level.getHeight() == height)
+                                   ? level
+                                   : level.rescaled (width, height, juce::Graphics::highResamplingQuality));
+        }
+
+        for (auto it = scaled.begin(); it != scaled.end();)
+            it = it->second.expired() ? scaled.erase (it) : std::next (it);
+
+        scaled [{ width, height }] = frames;
+        return frames;
+    }
+
+    const juce::Image source;
+    const int         numFrames;
+    const bool        horizontal;
+
+    std::vector<std::vector<juce::Image>>                         frameLevels;
+    std::map<std::pair<int, int>, std::weak_ptr<const ScaledFrames>> scaled;
+};
+
+/**
+ Keeps track of the Levels of all images in use, so ImagePyramids of the same image share them
+ */
+struct ImagePyramid::SharedPyramids
+{
+    std::shared_ptr<Levels> getLevels (const juce::Image& source, int numFrames, bool horizontal)
+    {
+        pyramids.erase (std::remove_if (pyramids.begin(), pyramids.end(), [] (const auto& p) { return p.expired(); }), pyramids.end());
+
+        for (const auto& pyramid : pyramids)
+            if (auto existing = pyramid.lock())
+                if (existing->source == source && existing->numFrames == numFrames && existing->horizontal == horizontal)
+                    return existing;
+
+        auto created = std::make_shared<Levels> (source, numFrames, horizontal);
+        pyramids.push_back (created);
+        return created;
+    }
+
+    // the Levels keep their source alive, so the pixel data of an image in this list can't be reused by another one
+    std::vector<std::weak_ptr<Levels>> pyramids;
+};
+
+ImagePyramid::ImagePyramid()  = default;
+ImagePyramid::~ImagePyramid() = default;
+
+void ImagePyramid::setImage (const juce::Image& image, int numFramesToUse, bool horizontalFrames)
+{
+    if (image == source && numFramesToUse == numFrames && horizontalFrames == horizontal)
+        return;
+
+    stopTimer();
+
+    source     = image;
+    numFrames  = std::max (1, numFramesToUse);
+    horizontal = horizontalFrames;
+
+    levels.reset();
+    scaledFrames.reset();
+    scaledFrameWidth   = 0;
+    scaledFrameHeight  = 0;
+    pendingFrameWidth  = 0;
+    pendingFrameHeight = 0;
+
+    if (source.isNull())
+        return;
+
+    const auto frameWidth  = horizontal ? source.getWidth() / numFrames : source.getWidth();
+    const auto frameHeight = horizontal ? source.getHeight() : source.getHeight() / numFrames;
+    if (frameWidth <= 0 || frameHeight <= 0)
+        return;
+
+    levels = sharedPyramids->getLevels (source, numFrames, horizontal);
+}
+
+void ImagePyramid::clear()
+{
+    setImage ({});
+}
+
+bool ImagePyramid::isNull() const
+{
+    return levels == nullptr;
+}
+
+void ImagePyramid::drawFrame (juce::Graphics& g, int frame, juce::Rectangle<float> target, juce::RectanglePlacement placement)
+{
+    if (levels == nullptr || target.isEmpty())
+        return;
+
+    const auto& sourceFrame = levels->frameLevels.front().front();
+    const auto placed = placement.appliedTo (sourceFrame.getBounds().toFloat(), target);
+    const auto scale  = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto width  = std::max (1, juce::roundToInt (placed.getWidth() * scale));
+    const auto height = std::max (1, juce::roundToInt (placed.getHeight() * scale));
+
+    if (width != scaledFrameWidth || height != scaledFrameHeight)
+    {
+        if (auto shared = levels->findScaledFrames (width, height))
+        {
+            // another ImagePyramid of the same image is drawn at this size already
+            stopTimer();
+            scaledFrames       = std::move (shared);
+            scaledFrameWidth   = width;
+            scaledFrameHeight  = height;
+            pendingFrameWidth  = 0;
+            pendingFrameHeight = 0;
+        }
+        else if (width != pendingFrameWidth || height != pendingFrameHeight)
+        {
+            // rebuild once the size stopped changing, meanwhile the old frames or the source are stretched
+            pendingFrameWidth  = width;
+            pendingFrameHeight = height;
+            startTimer (scaledFrames == nullptr ? 1 : 150);
+        }
+    }
+    else if (pendingFrameWidth > 0)
+    {
+        // the size went back before it settled
+        stopTimer();
+        pendingFrameWidth  = 0;
+        pendingFrameHeight = 0;
+    }
+
+    frame = juce::jlimit (0, numFrames - 1, frame);
+    const auto& image = scaledFrames != nullptr ? (*scaledFrames) [size_t (frame)]
+                                                : levels->frameLevels [size_t (frame)].front();
+
+    juce::Graphics::ScopedSaveState save (g);
+    g.reduceClipRegion (placed.getIntersection (target).toNearestInt());
+    g.drawImageTransformed (image, juce::AffineTransform::scale (placed.getWidth() / float (image.getWidth()),
+                                                                 placed.getHeight() / float (image.getHeight()))
+                                                         .translated (placed.getX(), placed.getY()));
+}
+
+juce::Image ImagePyramid::getScaledFrame (int frame, int width, int height)
+{
+    if (levels == nullptr || width <= 0 || height <= 0)
+        return {};
+
+    if (width != scaledFrameWidth || height != scaledFrameHeight)
+    {
+        stopTimer();
+        scaledFrames       = levels->getScaledFrames (width, height);
+        scaledFrameWidth   = width;
+        scaledFrameHeight  = height;
+        pendingFrameWidth  = 0;
+        pendingFrameHeight = 0;
+    }
+
+    return (*scaledFrames) [size_t (juce::jlimit (0, numFrames - 1, frame))];
+}
+
+int ImagePyramid::getLevelIndex (int sourceWidth, int sourceHeight, int width, int height)
+{
+    width  = std::max (1, width);
+    height = std::max (1, height);
+
+    int index = 0;
+    while ((sourceWidth >> (index + 1)) >= width && (sourceHeight >> (index + 1)) >= height)
+        ++index;
+
+    return index;
+}
+
+void ImagePyramid::timerCallback()
+{
+    stopTimer();
+
+    if (levels == nullptr || pendingFrameWidth <= 0 || pendingFrameHeight <= 0)
+        return;
+
+    scaledFrames       = levels->getScaledFrames (pendingFrameWidth, pendingFrameHeight);
+    scaledFrameWidth   = pendingFrameWidth;
+    scaledFrameHeight  = pendingFrameHeight;
+    pendingFrameWidth  = 0;
+    pendingFrameHeight = 0;
+
+    if (onScaledImageReady)
+        onScaledImageReady();
+}
+
+} // namespace foleys
@@ -0,0 +1,121 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace foleys
+{
+
+/**
+ The ImagePyramid keeps an image pre-scaled to the size it is drawn at in physical pixels, so
+ painting is a plain blit instead of resampling a large image each time. To keep rebuilding cheap
+ and the quality good, the source is successively halved (mip levels) and the closest level is used.
+
+ The image can be a filmstrip, in that case each frame is scaled on its own, so neighbouring frames
+ don't bleed into each other.
+
+ All ImagePyramids of the same image share the mip levels and the scaled frames, so many knobs
+ using one filmstrip need the memory only once. Until a scaled version for the size exists, the
+ source is stretched and the scaled frames are built on a timer, also when the size changes, e.g.
+ while the editor is resized. onScaledImageReady is called afterwards, so the owner can repaint.
+ ImagePyramids are used on the message thread only.
+ */
+class ImagePyramid : private juce::Timer
+{
+public:
+    ImagePyramid();
+    ~ImagePyramid() override;
+
+    /**
+     Set the source image.
+
+     @param image the source image
+     @param numFrames the number of frames if the image is a filmstrip
+     @param horizontalFrames if the frames are side by side rather than stacked
+     */
+    void setImage (const juce::Image& image, int numFrames = 1, bool horizontalFrames = false);
+
+    void clear();
+
+    bool isNull() const;
+
+    /**
+     Draw a frame of the image into the target rectangle, using the placement. The graphics
+     opacity is respected.
+     */
+    void drawFrame (juce::Graphics& g, int frame, juce::Rectangle<float> target,
+                    juce::RectanglePlacement placement = juce::RectanglePlacement::stretchToFit);
+
+    /**
+     Returns a frame scaled to the size in physical pixels, using the version shared with other
+     ImagePyramids of the same image if it exists. The pyramid keeps the frames of that size for drawing.
+     */
+    juce::Image getScaledFrame (int frame, int width, int height);
+
+    /**
+     Returns the index of the mip level to scale from. This is the smallest level, that is still
+     at least as big as the target, each level halving the one before.
+     */
+    static int getLevelIndex (int sourceWidth, int sourceHeight, int width, int height);
+
+    /**
+     Called on the message thread after a deferred rebuild, so the owner can repaint.
+     */
+    std::function<void()> onScaledImageReady;
+
+private:
+    struct Levels;
+    struct SharedPyramids;
+
+    using ScaledFrames = std::vector<juce::Image>;
+
+    void timerCallback() override;
+
+    juce::SharedResourcePointer<SharedPyramids> sharedPyramids;
+    std::shared_ptr<Levels>                     levels;
+    std::shared_ptr<const ScaledFrames>         scaledFrames;
+
+    juce::Image source;
+    int  numFrames  = 1;
+    bool horizontal = false;
+    int  scaledFrameWidth  = 0;
+    int  scaledFrameHeight = 0;
+    int  pendingFrameWidth  = 0;
+    int  pendingFrameHeight = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ImagePyramid)
+};
+
+} // namespace foleys
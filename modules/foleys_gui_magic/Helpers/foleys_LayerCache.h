@@ -0,0 +1,194 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+
+namespace foleys
+{
+
+/**
+ The LayerCache keeps the static layers of a procedurally drawn widget, e.g. the
+ body, shadow and ticks of a knob, as images at physical resolution. Only the value
+ dependent parts need to be drawn each time the widget repaints.
+
+ The images are looked up by a Key, that needs to contain everything the layer
+ depends on. Size and physical scale are added automatically. Since the LookAndFeels
+ are shared by all editors in the process, the cache is limited by memory rather
+ than by a number of layers. When the budget is exceeded, the least frequently used
+ images are dropped. Unlike dropping the least recently used, this keeps a part of the
+ layers cached when more widgets than fit into the budget are repainted one after
+ another. The use counts are halved regularly, so layers that aren't used anymore,
+ e.g. of a previous size, age out.
+ */
+class LayerCache
+{
+public:
+    /**
+     Hash of everything a cached layer depends on
+     */
+    struct Key
+    {
+        template<typename ValueType>
+        Key& add (ValueType value)
+        {
+            static_assert (std::is_arithmetic_v<ValueType>, "Only numbers can be added directly");
+            return add (&value, sizeof (value));
+        }
+
+        Key& add (juce::Colour colour)        { return add (colour.getARGB()); }
+        Key& add (const juce::String& text)   { return add (text.toRawUTF8(), text.getNumBytesAsUTF8()); }
+
+        Key& add (const void* data, size_t numBytes)
+        {
+            // FNV-1a
+            auto* bytes = static_cast<const juce::uint8*> (data);
+            for (size_t i = 0; i < numBytes; ++i)
+                hash = (hash ^ bytes [i]) * 1099511628211ull;
+
+            return *this;
+        }
+
+        juce::uint64 hash = 14695981039346656037ull;
+    };
+
+    LayerCache (size_t maxNumBytesToKeep = 16 * 1024 * 1024) : maxNumBytes (maxNumBytesToKeep) {}
+
+    /**
+     Draws a cached layer into area. If the layer is not cached yet, it is created
+     by calling paintLayer with a Graphics, whose origin is the top left of area.
+
+     @param g          the Graphics to draw into
+     @param area       the area in the coordinates of g
+     @param key        the Key of everything the layer depends on
+     @param paintLayer a callable taking juce::Graphics&, that paints the layer
+     */
+    template<typename PaintFunction>
+    void draw (juce::Graphics& g, juce::Rectangle<int> area, Key key, PaintFunction&& paintLayer)
+    {
+        if (area.isEmpty())
+            return;
+
+        const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        key.add (area.getWidth()).add (area.getHeight()).add (scale);
+
+        const auto& image = getLayer (key.hash, area, scale, paintLayer);
+        g.drawImageTransformed (image, juce::AffineTransform::scale (1.0f / scale).translated (area.getPosition()));
+    }
+
+    /**
+     Drops all cached layers, e.g. when the colours changed
+     */
+    void clear()
+    {
+        layers.clear();
+        numBytes = 0;
+    }
+
+    size_t getNumLayers() const { return layers.size(); }
+
+    /**
+     The number of layers that had to be painted, because they were not cached
+     */
+    size_t getNumMisses() const { return numMisses; }
+
+private:
+    struct Layer
+    {
+        juce::uint64 hash = 0;
+        juce::Image  image;
+        size_t       numBytes = 0;
+        juce::uint32 lastUsed = 0;
+        juce::uint32 uses     = 0;
+    };
+
+    static constexpr juce::uint32 agingInterval = 1024;
+
+    template<typename PaintFunction>
+    const juce::Image& getLayer (juce::uint64 hash, juce::Rectangle<int> area, float scale, PaintFunction& paintLayer)
+    {
+        if (++counter % agingInterval == 0)
+            for (auto& layer : layers)
+                layer.uses /= 2;
+
+        for (auto& layer : layers)
+        {
+            if (layer.hash == hash)
+            {
+                layer.lastUsed = counter;
+                ++layer.uses;
+                return layer.image;
+            }
+        }
+
+        ++numMisses;
+
+        const auto width  = juce::roundToInt (std::ceil (area.getWidth() * scale));
+        const auto height = juce::roundToInt (std::ceil (area.getHeight() * scale));
+        const auto bytes  = size_t (width) * size_t (height) * 4;
+
+        while (numBytes + bytes > maxNumBytes && ! layers.empty())
+        {
+            auto victim = std::min_element (layers.begin(), layers.end(), [] (const auto& a, const auto& b)
+            {
+                // of equally used layers the newest goes, so the ones already cached stay
+                return a.uses < b.uses || (a.uses == b.uses && a.lastUsed > b.lastUsed);
+            });
+
+            numBytes -= victim->numBytes;
+            layers.erase (victim);
+        }
+
+        juce::Image image (juce::Image::ARGB, width, height, true);
+        {
+            juce::Graphics g (image);
+            g.addTransform (juce::AffineTransform::scale (scale));
+            paintLayer (g);
+        }
+
+        numBytes += bytes;
+        layers.push_back ({ hash, image, bytes, counter, 1 });
+        return layers.back().image;
+    }
+
+    std::vector<Layer> layers;
+    size_t             maxNumBytes = 0;
+    size_t             numBytes = 0;
+    size_t             numMisses = 0;
+    juce::uint32       counter = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LayerCache)
+};
+
+} // namespace foleys
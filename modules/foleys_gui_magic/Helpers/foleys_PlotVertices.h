@@ -0,0 +1,166 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+
+namespace foleys
+{
+
+/**
+ Creates the vertices to draw a plot line as GL_TRIANGLES. Each line segment becomes a quad of two
+ triangles, lineWidth wide. The vertices are appended as x, y pairs, moved by offset.
+ */
+inline void createPlotStrokeVertices (const juce::Point<float>* points, size_t numPoints, juce::Point<float> offset, float lineWidth, std::vector<float>& vertices)
+{
+    for (size_t i = 1; i < numPoints; ++i)
+    {
+        const auto start  = points [i - 1] + offset;
+        const auto end    = points [i] + offset;
+        const auto delta  = end - start;
+        const auto length = delta.getDistanceFromOrigin();
+
+        if (length <= 0.0f)
+            continue;
+
+        const auto normal = juce::Point<float> (-delta.y, delta.x) * (0.5f * lineWidth / length);
+
+        vertices.insert (vertices.end(),
+                         { start.x + normal.x, start.y + normal.y,
+                           start.x - normal.x, start.y - normal.y,
+                           end.x   + normal.x, end.y   + normal.y,
+                           end.x   + normal.x, end.y   + normal.y,
+                           start.x - normal.x, start.y - normal.y,
+                           end.x   - normal.x, end.y   - normal.y });
+    }
+}
+
+inline void createPlotStrokeVertices (const std::vector<juce::Point<float>>& points, float lineWidth, std::vector<float>& vertices)
+{
+    createPlotStrokeVertices (points.data(), points.size(), {}, lineWidth, vertices);
+}
+
+/**
+ Creates the vertices to fill the area under a plot line down to bottom as GL_TRIANGLE_STRIP.
+ The vertices are appended as x, y pairs, moved by offset.
+ */
+inline void createPlotFillVertices (const juce::Point<float>* points, size_t numPoints, juce::Point<float> offset, float bottom, std::vector<float>& vertices)
+{
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        const auto point = points [i] + offset;
+        vertices.insert (vertices.end(), { point.x, point.y, point.x, bottom });
+    }
+}
+
+inline void createPlotFillVertices (const std::vector<juce::Point<float>>& points, float bottom, std::vector<float>& vertices)
+{
+    createPlotFillVertices (points.data(), points.size(), {}, bottom, vertices);
+}
+
+/**
+ The flattened line of a plot. The points of all sub paths are stored one after another, each sub path
+ starts at one of the subPathStarts, so the vertices don't join separate sub paths. It keeps its
+ memory, so it only allocates if a plot has more points than before.
+ */
+struct PlotLine
+{
+    std::vector<juce::Point<float>> points;
+    std::vector<size_t>             subPathStarts;
+
+    void clear()
+    {
+        points.clear();
+        subPathStarts.clear();
+    }
+
+    bool isEmpty() const noexcept { return points.empty(); }
+
+    void setPath (const juce::Path& path)
+    {
+        clear();
+
+        int subPath = -1;
+        for (juce::PathFlatteningIterator it (path); it.next();)
+        {
+            if (it.subPathIndex != subPath)
+            {
+                subPath = it.subPathIndex;
+                subPathStarts.push_back (points.size());
+                points.push_back ({ it.x1, it.y1 });
+            }
+
+            points.push_back ({ it.x2, it.y2 });
+        }
+    }
+
+    size_t getSubPathEnd (size_t subPath) const
+    {
+        return subPath + 1 < subPathStarts.size() ? subPathStarts [subPath + 1] : points.size();
+    }
+};
+
+/**
+ Creates the GL_TRIANGLES of all sub paths of a plot line.
+ */
+inline void createPlotStrokeVertices (const PlotLine& line, juce::Point<float> offset, float lineWidth, std::vector<float>& vertices)
+{
+    for (size_t i = 0; i < line.subPathStarts.size(); ++i)
+    {
+        const auto start = line.subPathStarts [i];
+        createPlotStrokeVertices (line.points.data() + start, line.getSubPathEnd (i) - start, offset, lineWidth, vertices);
+    }
+}
+
+/**
+ Creates one GL_TRIANGLE_STRIP for all sub paths of a plot line. The sub paths are connected by
+ degenerate triangles, which have no area, so no fill is drawn between them.
+ */
+inline void createPlotFillVertices (const PlotLine& line, juce::Point<float> offset, float bottom, std::vector<float>& vertices)
+{
+    for (size_t i = 0; i < line.subPathStarts.size(); ++i)
+    {
+        const auto start = line.subPathStarts [i];
+
+        if (! vertices.empty())
+        {
+            const auto first = line.points [start] + offset;
+            vertices.insert (vertices.end(), { vertices [vertices.size() - 2], vertices [vertices.size() - 1], first.x, first.y });
+        }
+
+        createPlotFillVertices (line.points.data() + start, line.getSubPathEnd (i) - start, offset, bottom, vertices);
+    }
+}
+
+} // namespace foleys
@@ -0,0 +1,135 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace foleys
+{
+
+/**
+ The PropertyMirrorBase follows a single property in a ValueTree node. Unlike a juce::Value
+ it is updated synchronously whenever the property is set.
+ */
+class PropertyMirrorBase : private juce::ValueTree::Listener
+{
+public:
+    PropertyMirrorBase (const juce::Identifier& propertyToFollow)
+      : property (propertyToFollow)
+    {
+    }
+
+    ~PropertyMirrorBase() override
+    {
+        node.removeListener (this);
+    }
+
+    /**
+     Let the mirror follow the property in a different node. This is called by the
+     MagicGUIState, when the property tree was restructured.
+     */
+    void referTo (juce::ValueTree nodeToFollow)
+    {
+        node.removeListener (this);
+        node = nodeToFollow;
+        node.addListener (this);
+
+        update (node.getProperty (property));
+    }
+
+    /**
+     Publishes the property of a node without following that node. The MagicGUIState uses this
+     on the thread restoring the state, the mirror is connected later on the message thread.
+     */
+    void publish (const juce::ValueTree& restoredNode)
+    {
+        update (restoredNode.getProperty (property));
+    }
+
+    const juce::ValueTree& getNode() const { return node; }
+
+protected:
+    virtual void update (const juce::var& value) = 0;
+
+private:
+    void valueTreePropertyChanged (juce::ValueTree& tree, const juce::Identifier& changed) override
+    {
+        if (changed == property && tree == node)
+            update (node.getProperty (property));
+    }
+
+    juce::ValueTree        node;
+    const juce::Identifier property;
+
+    JUCE_DECLARE_NON_COPYABLE (PropertyMirrorBase)
+};
+
+/**
+ The PropertyMirror keeps a lock-free copy of a property in the MagicGUIState, so the audio thread
+ can read a GUI property without going through juce::Value. Get one from MagicGUIState::getPropertyMirror().
+ */
+template<typename T>
+class PropertyMirror : public PropertyMirrorBase
+{
+public:
+    static_assert (std::atomic<T>::is_always_lock_free, "PropertyMirror needs a type that is lock free as atomic");
+
+    PropertyMirror (const juce::Identifier& propertyToFollow)
+      : PropertyMirrorBase (propertyToFollow)
+    {
+    }
+
+    /**
+     Return the current value of the property. This is safe to call from the audio thread.
+     */
+    T get() const noexcept
+    {
+        return value.load (std::memory_order_relaxed);
+    }
+
+private:
+    void update (const juce::var& newValue) override
+    {
+        if constexpr (std::is_enum_v<T>)
+            value.store (static_cast<T> (static_cast<int> (newValue)), std::memory_order_relaxed);
+        else
+            value.store (static_cast<T> (newValue), std::memory_order_relaxed);
+    }
+
+    std::atomic<T> value { T{} };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PropertyMirror)
+};
+
+} // namespace foleys
@@ -0,0 +1,127 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace foleys
+{
+
+/**
+ The SeqLock allows one thread to publish a small trivially copyable struct, that any number
+ of other threads can read without blocking the writer. A reader will never see a torn value,
+ instead it will retry until it got a consistent copy.
+
+ The writer is wait free, which makes it suitable to send information from the audio thread.
+ There must only be one writing thread at a time.
+ */
+template<typename T>
+class SeqLock
+{
+public:
+    static_assert (std::is_trivially_copyable_v<T>, "SeqLock can only hold trivially copyable types");
+
+    SeqLock() : SeqLock (T{}) {}
+    explicit SeqLock (const T& initial) { store (initial); }
+
+    /**
+     Publish a new value. Only one thread may call this at a time.
+     */
+    void store (const T& value) noexcept
+    {
+        std::array<std::uint64_t, numWords> buffer {};
+        std::memcpy (buffer.data(), &value, sizeof (T));
+
+        const auto seq = sequence.load (std::memory_order_relaxed);
+        sequence.store (seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence (std::memory_order_release);
+
+        for (size_t i = 0; i < numWords; ++i)
+            words [i].store (buffer [i], std::memory_order_relaxed);
+
+        sequence.store (seq + 2, std::memory_order_release);
+    }
+
+    /**
+     Try to read a consistent copy. This returns false, if the writer was busy.
+     */
+    bool tryLoad (T& result) const noexcept
+    {
+        const auto before = sequence.load (std::memory_order_acquire);
+        if (before & 1)
+            return false;
+
+        std::array<std::uint64_t, numWords> buffer;
+        for (size_t i = 0; i < numWords; ++i)
+            buffer [i] = words [i].load (std::memory_order_relaxed);
+
+        std::atomic_thread_fence (std::memory_order_acquire);
+        if (sequence.load (std::memory_order_relaxed) != before)
+            return false;
+
+        std::memcpy (&result, buffer.data(), sizeof (T));
+        return true;
+    }
+
+    /**
+     Read a consistent copy, spinning while the writer is busy.
+     */
+    T load() const noexcept
+    {
+        T result;
+        while (! tryLoad (result))
+            std::this_thread::yield();
+
+        return result;
+    }
+
+    /**
+     The sequence counter is increased by two on each store. You can use that to
+     find out cheaply, if a new value was published since you last looked.
+     */
+    std::uint32_t getSequence() const noexcept
+    {
+        return sequence.load (std::memory_order_acquire);
+    }
+
+private:
+    static constexpr size_t numWords = (sizeof (T) + sizeof (std::uint64_t) - 1) / sizeof (std::uint64_t);
+
+    std::atomic<std::uint32_t>                        sequence { 0 };
+    std::array<std::atomic<std::uint64_t>, numWords>  words;
+
+    JUCE_DECLARE_NON_COPYABLE (SeqLock)
+};
+
+} // namespace foleys
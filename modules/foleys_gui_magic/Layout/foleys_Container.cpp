@@ -192,6 +192,20 @@ GuiItem* Container::findGuiItem (const juce::ValueTree& node)
     return nullptr;
 }
 
+GuiItem* Container::findChildItem (const juce::ValueTree& node) const
+{
+    // the children are created in the order of the nodes, unless a node had no factory
+    const auto index = configNode.indexOf (node);
+    if (juce::isPositiveAndBelow (index, children.size()) && children [size_t (index)]->getNode() == node)
+        return children [size_t (index)].get();
+
+    for (const auto& child : children)
+        if (child->getNode() == node)
+            return child.get();
+
+    return nullptr;
+}
+
 void Container::setLayoutMode (LayoutType layoutToUse)
 {
     layout = layoutToUse;
@@ -450,7 +464,7 @@ Container::Scroller::Scroller (Container& ownerToUse)
 void Container::Scroller::paint (juce::Graphics& g)
 {
     auto b = owner.getClientBounds();
-    owner.decorator.drawDecorator (g, {-b.getX(), -b.getY(), owner.getWidth(), owner.getHeight()});
+    owner.decorator.drawDecorator (g, {-b.getX(), -b.getY(), owner.getWidth(), owner.getHeight()}, owner.getLookAndFeel());
 }
 
 void Container::Scroller::setBackgroundColour (juce::Colour colour)
@@ -129,6 +129,11 @@ public:
      */
     GuiItem* findGuiItem (const juce::ValueTree& node) override;
 
+    /**
+     Returns the item of a direct child node, without searching the descendants
+     */
+    GuiItem* findChildItem (const juce::ValueTree& node) const;
+
     /**
      This switches this node and all it's descendents in the edit
      mode, which means, the components don't react, but instead you
@@ -36,7 +36,48 @@
 namespace foleys
 {
 
-void Decorator::drawDecorator (juce::Graphics& g, juce::Rectangle<int> bounds)
+Decorator::Decorator()
+{
+    backgroundImage.onScaledImageReady = [this]
+    {
+        ++styleGeneration;
+
+        if (onNeedsRepaint)
+            onNeedsRepaint();
+    };
+}
+
+void Decorator::drawDecorator (juce::Graphics& g, juce::Rectangle<int> bounds, const juce::LookAndFeel& lookAndFeel)
+{
+    if (! cacheBackground || bounds.isEmpty())
+    {
+        paintDecorator (g, bounds);
+        return;
+    }
+
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    if (cachedBackground.isNull() || cachedBounds.getWidth() != bounds.getWidth() || cachedBounds.getHeight() != bounds.getHeight()
+        || cachedScale != scale || cachedGeneration != styleGeneration || cachedLookAndFeel != &lookAndFeel)
+    {
+        cachedBackground = juce::Image (juce::Image::ARGB,
+                                        juce::roundToInt (bounds.getWidth() * scale),
+                                        juce::roundToInt (bounds.getHeight() * scale), true);
+
+        juce::Graphics cacheGraphics (cachedBackground);
+        cacheGraphics.addTransform (juce::AffineTransform::scale (scale));
+        paintDecorator (cacheGraphics, bounds.withZeroOrigin());
+
+        cachedBounds      = bounds;
+        cachedScale       = scale;
+        cachedGeneration  = styleGeneration;
+        cachedLookAndFeel = &lookAndFeel;
+    }
+
+    g.drawImage (cachedBackground, bounds.toFloat());
+}
+
+void Decorator::paintDecorator (juce::Graphics& g, juce::Rectangle<int> bounds)
 {
     juce::Graphics::ScopedSaveState stateSave (g);
 
@@ -66,7 +107,7 @@ void Decorator::drawDecorator (juce::Graphics& g, juce::Rectangle<int> bounds)
     {
         juce::Graphics::ScopedSaveState save (g);
         g.setOpacity (backgroundAlpha);
-        g.drawImage (backgroundImage, boundsf, backgroundPlacement);
+        backgroundImage.drawFrame (g, 0, boundsf, backgroundPlacement);
     }
 
     if (border > 0.0f)
@@ -109,6 +150,8 @@ juce::Colour Decorator::getBackgroundColour() const
 
 void Decorator::updateColours (MagicGUIBuilder& builder, const juce::ValueTree& node)
 {
+    ++styleGeneration;
+
     auto& stylesheet = builder.getStylesheet();
 
     auto bg = builder.getStyleProperty (IDs::backgroundColour, node);
@@ -154,6 +197,8 @@ Decorator::ClientBounds Decorator::getClientBounds (juce::Rectangle<int> overall
 
 void Decorator::configure (MagicGUIBuilder& builder, const juce::ValueTree& node)
 {
+    ++styleGeneration;
+
     auto& stylesheet = builder.getStylesheet();
 
     auto borderVar = builder.getStyleProperty (IDs::border, node);
@@ -188,7 +233,7 @@ void Decorator::configure (MagicGUIBuilder& builder, const juce::ValueTree& node
     else
         justification = juce::Justification::centredTop;
 
-    backgroundImage = stylesheet.getBackgroundImage (node);
+    backgroundImage.setImage (stylesheet.getBackgroundImage (node));
     backgroundGradient.setup (builder.getStyleProperty (IDs::backgroundGradient, node).toString(), stylesheet);
 
     auto alphaVar = builder.getStyleProperty (IDs::backgroundAlpha, node);
@@ -205,6 +250,8 @@ void Decorator::configure (MagicGUIBuilder& builder, const juce::ValueTree& node
         else if (backPlacement.toString() == IDs::imageCentred)
             backgroundPlacement = juce::RectanglePlacement::centred;
     }
+
+    cacheBackground = builder.getStyleProperty (IDs::cacheBackground, node);
 }
 
 void Decorator::reset()
@@ -225,10 +272,14 @@ void Decorator::reset()
     tabCaption.clear();
     tabColour = juce::Colours::darkgrey;
 
-    backgroundImage = juce::Image();
+    backgroundImage.clear();
     backgroundAlpha = 1.0f;
     backgroundPlacement = juce::RectanglePlacement::centred;
     backgroundGradient.clear();
+
+    cacheBackground = false;
+    cachedBackground = juce::Image();
+    ++styleGeneration;
 }
 
 }
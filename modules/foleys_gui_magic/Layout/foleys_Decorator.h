@@ -33,6 +33,7 @@
 
 #include "foleys_BoxModel.h"
 #include "foleys_GradientBackground.h"
+#include "../Helpers/foleys_ImagePyramid.h"
 
 namespace foleys
 {
@@ -43,7 +44,7 @@ class Decorator
 {
 public:
 
-    Decorator() = default;
+    Decorator();
 
     /**
      This will get the necessary information from the stylesheet, using inheritance
@@ -55,7 +56,17 @@ public:
 
     void updateColours (MagicGUIBuilder& builder, const juce::ValueTree& node);
 
-    void drawDecorator (juce::Graphics& g, juce::Rectangle<int> bounds);
+    /**
+     Draws background, border and caption. If cache-background is set in the style, this is
+     rendered once into an image, that is reused as long as size, scale, style and the
+     LookAndFeel of the owning component don't change.
+     */
+    void drawDecorator (juce::Graphics& g, juce::Rectangle<int> bounds, const juce::LookAndFeel& lookAndFeel);
+
+    /**
+     Returns the image of the cached background, or a null image if it isn't cached.
+     */
+    juce::Image getCachedBackground() const { return cachedBackground; }
 
     struct ClientBounds
     {
@@ -70,8 +81,15 @@ public:
 
     juce::Colour getBackgroundColour() const;
 
+    /**
+     Called when the decoration changed by itself, e.g. when a background image was rescaled.
+     */
+    std::function<void()> onNeedsRepaint;
+
 private:
 
+    void paintDecorator (juce::Graphics& g, juce::Rectangle<int> bounds);
+
     juce::Colour backgroundColour { juce::Colours::darkgrey };
     juce::Colour borderColour     { juce::Colours::silver };
 
@@ -88,11 +106,19 @@ private:
     juce::String        tabCaption;
     juce::Colour        tabColour;
 
-    juce::Image                 backgroundImage;
+    ImagePyramid                backgroundImage;
     float                       backgroundAlpha = 1.0f;
     juce::RectanglePlacement    backgroundPlacement = juce::RectanglePlacement::centred;
     GradientBackground          backgroundGradient;
 
+    bool                        cacheBackground = false;
+    juce::Image                 cachedBackground;
+    juce::Rectangle<int>        cachedBounds;
+    float                       cachedScale = 0.0f;
+    const juce::LookAndFeel*    cachedLookAndFeel = nullptr;
+    int                         styleGeneration = 0;
+    int                         cachedGeneration = -1;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Decorator)
 };
 
@@ -43,14 +43,24 @@ GuiItem::GuiItem (MagicGUIBuilder& builder, juce::ValueTree node)
     setOpaque (false);
     setInterceptsMouseClicks (false, true);
 
+    decorator.onNeedsRepaint = [this] { repaint(); };
+
     visibility.addListener (this);
     configNode.addListener (this);
     magicBuilder.getStylesheet().addListener (this);
+
+    indexedId = configNode.getProperty (IDs::id, juce::String()).toString();
+    magicBuilder.registerGuiItem (*this, indexedId);
 }
 
 GuiItem::~GuiItem()
 {
+    magicBuilder.unregisterGuiItem (*this, indexedId);
     magicBuilder.getStylesheet().removeListener (this);
+
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    paintProfiler->removeComponent (this);
+#endif
 }
 
 void GuiItem::setColourTranslation (std::vector<std::pair<juce::String, int>> mapping)
@@ -90,8 +100,14 @@ void GuiItem::updateInternal()
 {
     auto& stylesheet = magicBuilder.getStylesheet();
 
-    if (auto* newLookAndFeel = stylesheet.getLookAndFeel (configNode))
-        setLookAndFeel (newLookAndFeel);
+    if (lookAndFeelGeneration != stylesheet.getStyleGeneration())
+    {
+        resolvedLookAndFeel = stylesheet.getLookAndFeel (configNode);
+        lookAndFeelGeneration = stylesheet.getStyleGeneration();
+    }
+
+    if (resolvedLookAndFeel != nullptr)
+        setLookAndFeel (resolvedLookAndFeel);
 
     decorator.configure (magicBuilder, configNode);
     configureComponent();
@@ -216,6 +232,19 @@ void GuiItem::configurePosition (const juce::var& v, Position& p, double d)
     {
         p.absolute = magicBuilder.getPropertyDefaultValue (IDs::display) == IDs::contents;
         p.value = d;
+        p.source = v;
+        return;
+    }
+
+    if (! p.source.isVoid() && v.equalsWithSameType (p.source))
+        return;
+
+    p.source = v;
+
+    if (v.isInt() || v.isInt64() || v.isDouble())
+    {
+        p.absolute = true;
+        p.value = double (v);
     }
     else
     {
@@ -225,6 +254,23 @@ void GuiItem::configurePosition (const juce::var& v, Position& p, double d)
     }
 }
 
+juce::var GuiItem::Position::toVar (int parentSize) const
+{
+    if (absolute)
+        return juce::roundToInt (value);
+
+    const auto pixels = juce::roundToInt (value * parentSize * 0.01);
+
+    for (int decimals = 0; decimals <= 6; ++decimals)
+    {
+        const auto text = decimals > 0 ? juce::String (value, decimals) : juce::String (juce::roundToInt (value));
+        if (juce::roundToInt (text.getDoubleValue() * parentSize * 0.01) == pixels)
+            return text + "%";
+    }
+
+    return juce::String (value) + "%";
+}
+
 juce::Rectangle<int> GuiItem::resolvePosition (juce::Rectangle<int> parent)
 {
     return juce::Rectangle<int>
@@ -238,7 +284,12 @@ juce::Rectangle<int> GuiItem::resolvePosition (juce::Rectangle<int> parent)
 
 void GuiItem::paint (juce::Graphics& g)
 {
-    decorator.drawDecorator (g, getLocalBounds());
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    // stopped in paintOverChildren, so the wrapped component and nested items are included
+    paintStartTicks = paintProfiler->startPaint (*this);
+#endif
+
+    decorator.drawDecorator (g, getLocalBounds(), getLookAndFeel());
 }
 
 juce::Rectangle<int> GuiItem::getClientBounds() const
@@ -288,10 +339,21 @@ void GuiItem::valueChanged (juce::Value& source)
         setVisible (visibility.getValue());
 }
 
-void GuiItem::valueTreePropertyChanged (juce::ValueTree& treeThatChanged, const juce::Identifier&)
+void GuiItem::valueTreePropertyChanged (juce::ValueTree& treeThatChanged, const juce::Identifier& property)
 {
     if (treeThatChanged == configNode)
     {
+        if (property == IDs::id)
+        {
+            magicBuilder.unregisterGuiItem (*this, indexedId);
+            indexedId = configNode.getProperty (IDs::id, juce::String()).toString();
+            magicBuilder.registerGuiItem (*this, indexedId);
+        }
+
+        // these are used to look up styles, also for child nodes
+        if (property == IDs::id || property == IDs::styleClass || property == IDs::lookAndFeel)
+            magicBuilder.getStylesheet().invalidateStyleCache();
+
         if (auto* parent = findParentComponentOfClass<GuiItem>())
             parent->updateInternal();
         else
@@ -380,6 +442,13 @@ void GuiItem::paintOverChildren (juce::Graphics& g)
         g.setColour (juce::Colours::red);
         g.drawFittedText (highlight, getLocalBounds(), juce::Justification::centred, 3);
     }
+
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    if (paintStartTicks != 0)
+        paintProfiler->addPaint (*this, configNode.getType().toString(), paintStartTicks, g.getClipBounds());
+
+    paintStartTicks = 0;
+#endif
 }
 
 void GuiItem::setEditMode (bool shouldEdit)
@@ -404,10 +473,7 @@ void GuiItem::setDraggable (bool selected)
         {
             magicBuilder.getUndoManager().beginNewTransaction ("Drag component position");
         };
-        borderDragger->onDragging = [&]
-        {
-            savePosition();
-        };
+        // the border dragger resizes the component live, the node is only written once at the end
         borderDragger->onDragEnd = [&]
         {
             savePosition();
@@ -423,7 +489,7 @@ void GuiItem::setDraggable (bool selected)
     }
 }
 
-void GuiItem::savePosition ()
+void GuiItem::savePosition()
 {
     auto findContainer = [&](){
         
@@ -441,16 +507,28 @@ void GuiItem::savePosition ()
 
     auto parent = container->getClientBounds();
 
-    auto px = posX.absolute ? juce::String (getX() - parent.getX()) : juce::String (100.0 * (getX() - parent.getX()) / parent.getWidth()) + "%";
-    auto py = posY.absolute ? juce::String (getY() - parent.getY()) : juce::String (100.0 * (getY() - parent.getY()) / parent.getHeight()) + "%";
-    auto pw = posWidth.absolute ? juce::String (getWidth()) : juce::String (100.0 * getWidth() / parent.getWidth()) + "%";
-    auto ph = posHeight.absolute ? juce::String (getHeight()) : juce::String (100.0 * getHeight() / parent.getHeight()) + "%";
+    // all values are taken before writing, because each write lays out the item again.
+    // The source is set as well, so the write doesn't parse the rounded value back
+    auto store = [] (Position& p, int pixels, int parentSize)
+    {
+        if (p.absolute)
+            p.value = pixels;
+        else if (parentSize > 0)
+            p.value = 100.0 * pixels / parentSize;
+
+        p.source = p.toVar (parentSize);
+    };
+
+    store (posX,      getX() - parent.getX(), parent.getWidth());
+    store (posY,      getY() - parent.getY(), parent.getHeight());
+    store (posWidth,  getWidth(),             parent.getWidth());
+    store (posHeight, getHeight(),            parent.getHeight());
 
     auto* undo = &magicBuilder.getUndoManager();
-    configNode.setProperty (IDs::posX, px, undo);
-    configNode.setProperty (IDs::posY, py, undo);
-    configNode.setProperty (IDs::posWidth, pw, undo);
-    configNode.setProperty (IDs::posHeight, ph, undo);
+    configNode.setProperty (IDs::posX, posX.source, undo);
+    configNode.setProperty (IDs::posY, posY.source, undo);
+    configNode.setProperty (IDs::posWidth, posWidth.source, undo);
+    configNode.setProperty (IDs::posHeight, posHeight.source, undo);
 }
 
 void GuiItem::mouseDown (const juce::MouseEvent& event)
@@ -467,7 +545,6 @@ void GuiItem::mouseDrag (const juce::MouseEvent& event)
     if (componentDragger)
     {
         componentDragger->dragComponent (this, event, nullptr);
-        savePosition();
     }
     else if (event.mouseWasDraggedSinceMouseDown())
     {
@@ -478,6 +555,10 @@ void GuiItem::mouseDrag (const juce::MouseEvent& event)
 
 void GuiItem::mouseUp (const juce::MouseEvent& event)
 {
+    // the drag moved the component only, write the new position as one undo transaction
+    if (componentDragger && event.mouseWasDraggedSinceMouseDown())
+        savePosition();
+
     if (! event.mouseWasDraggedSinceMouseDown())
         magicBuilder.setSelectedNode (configNode);
 }
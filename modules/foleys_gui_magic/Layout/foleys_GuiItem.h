@@ -82,6 +82,13 @@ public:
      */
     virtual std::vector<SettableProperty> getSettableProperties() const { return {}; }
 
+    /**
+     Hide these in your GuiItem and register it with MagicGUIBuilder::registerFactoryWithMetadata(),
+     so the GUI editor can list the properties and colours without creating an instance.
+     */
+    static std::vector<SettableProperty> settableProperties (MagicGUIBuilder&, const juce::ValueTree&) { return {}; }
+    static std::vector<std::pair<juce::String, int>> colourTranslationTable() { return {}; }
+
     /**
      For each factory you can register a translation table, which will forward the colours from the
      Stylesheet to the Components.
@@ -156,6 +163,12 @@ public:
      */
     juce::Rectangle<int> resolvePosition (juce::Rectangle<int> parent);
 
+    /**
+     Writes the current bounds as position into the node, keeping each value absolute or
+     relative as it was. This is called when the item was dragged in the editor.
+     */
+    void savePosition();
+
     /**
      Returns the bounds of the wrapped Component. This is the GuiItems bounds
      reduced by margin, padding and the caption, if one was set.
@@ -241,7 +254,7 @@ private:
 
     void valueChanged (juce::Value& source) override;
 
-    void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override;
+    void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier& property) override;
 
     void valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&) override;
 
@@ -259,17 +272,39 @@ private:
 
     juce::Value     visibility { true };
 
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    SharedPaintProfiler paintProfiler;
+    juce::int64         paintStartTicks = 0;
+#endif
+
     juce::String    highlight;
 
+    /** The id this item is registered with in the MagicGUIBuilder's lookup */
+    juce::String    indexedId;
+
+    juce::LookAndFeel* resolvedLookAndFeel = nullptr;
+    juce::uint32       lookAndFeelGeneration = 0;
+
+    /**
+     A length, either absolute in pixels or in percent of the parent. Absolute values are
+     stored as numbers in the ValueTree, percentages as strings like "50%", so the XML stays
+     compatible. The last parsed var is kept to skip parsing if it didn't change.
+     */
     struct Position
     {
-        bool   absolute = true;
-        double value = 0.0;
+        bool      absolute = true;
+        double    value = 0.0;
+        juce::var source;
+
+        /**
+         Percentages are written with the fewest decimals that still resolve to the same pixel
+         in a parent of that size.
+         */
+        juce::var toVar (int parentSize) const;
     };
     Position posX, posY, posWidth, posHeight;
 
     void configurePosition (const juce::var& v, Position& p, double d);
-    void savePosition ();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GuiItem)
 };
@@ -0,0 +1,159 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_ResolvedStyles.h"
+
+namespace foleys
+{
+
+void ResolvedStyles::resolve (const Stylesheet& stylesheet, const juce::ValueTree& tree, const PropertiesPerType& properties, juce::ThreadPool& pool)
+{
+    clear();
+    styleGeneration = stylesheet.getStyleGeneration();
+
+    collectNodes (tree);
+
+    std::atomic<size_t> next { 0 };
+    auto resolveNext = [&]
+    {
+        for (auto i = next++; i < records.size(); i = next++)
+            resolveRecord (records [i], stylesheet, properties);
+    };
+
+    const auto numJobs = pool.getNumThreads();
+    std::atomic<int>   running { numJobs };
+    juce::WaitableEvent finished;
+
+    for (int i = 0; i < numJobs; ++i)
+    {
+        pool.addJob ([&]
+        {
+            resolveNext();
+
+            if (--running == 0)
+                finished.signal();
+        });
+    }
+
+    resolveNext();
+
+    if (numJobs > 0)
+        finished.wait();
+}
+
+const juce::var* ResolvedStyles::find (const juce::Identifier& name, const juce::ValueTree& node) const
+{
+    if (records.empty())
+        return nullptr;
+
+    if (lastRecord == nullptr || lastNode != node)
+    {
+        lastNode   = node;
+        lastRecord = findRecord (node);
+    }
+
+    return lastRecord != nullptr ? lastRecord->properties.getVarPointer (name) : nullptr;
+}
+
+const ResolvedStyles::Record* ResolvedStyles::findRecord (const juce::ValueTree& node) const
+{
+    const auto index = recordIndices.find (getIdentity (node));
+    return index != recordIndices.end() ? &records [index->second] : nullptr;
+}
+
+void ResolvedStyles::clear()
+{
+    records.clear();
+    recordIndices.clear();
+    lastNode   = juce::ValueTree();
+    lastRecord = nullptr;
+}
+
+juce::Array<juce::Identifier> ResolvedStyles::getCommonProperties()
+{
+    return {
+        IDs::lookAndFeel, IDs::display,
+        // decorator
+        IDs::border, IDs::margin, IDs::padding, IDs::radius,
+        IDs::caption, IDs::captionSize, IDs::captionPlacement, IDs::captionColour,
+        IDs::tabCaption, IDs::tabColour,
+        IDs::backgroundColour, IDs::borderColour,
+        IDs::backgroundImage, IDs::backgroundGradient, IDs::backgroundAlpha, IDs::imagePlacement, IDs::cacheBackground,
+        // component
+        IDs::tooltip, IDs::visibility,
+        IDs::accessibility, IDs::accessibilityTitle, IDs::accessibilityDescription, IDs::accessibilityHelpText, IDs::accessibilityFocusOrder,
+        // flex item
+        IDs::minWidth, IDs::maxWidth, IDs::minHeight, IDs::maxHeight, IDs::width, IDs::height,
+        IDs::flexGrow, IDs::flexShrink, IDs::flexOrder, IDs::flexAlignSelf,
+        // position
+        IDs::posX, IDs::posY, IDs::posWidth, IDs::posHeight
+    };
+}
+
+juce::Array<juce::Identifier> ResolvedStyles::getContainerProperties()
+{
+    return {
+        IDs::flexDirection, IDs::flexWrap, IDs::flexAlignContent, IDs::flexAlignItems, IDs::flexJustifyContent,
+        IDs::scrollMode, IDs::tabHeight, IDs::selectedTab, IDs::repaintHz, IDs::focusContainerType
+    };
+}
+
+void ResolvedStyles::collectNodes (const juce::ValueTree& node)
+{
+    recordIndices [getIdentity (node)] = records.size();
+    records.push_back ({ node, {} });
+
+    for (const auto& child : node)
+        collectNodes (child);
+}
+
+void ResolvedStyles::resolveRecord (Record& record, const Stylesheet& stylesheet, const PropertiesPerType& properties) const
+{
+    static const auto commonProperties = getCommonProperties();
+
+    for (const auto& name : commonProperties)
+        record.properties.set (name, stylesheet.getStyleProperty (name, record.node));
+
+    auto typeProperties = properties.find (record.node.getType());
+    if (typeProperties != properties.end())
+        for (const auto& name : typeProperties->second)
+            if (! record.properties.contains (name))
+                record.properties.set (name, stylesheet.getStyleProperty (name, record.node));
+
+    // decode the image now, the GuiItem will find it in the ImageAssetCache
+    const auto* image = record.properties.getVarPointer (IDs::backgroundImage);
+    if (image != nullptr && image->toString().isNotEmpty())
+        Resources::getImage (image->toString());
+}
+
+} // namespace foleys
@@ -0,0 +1,123 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_data_structures/juce_data_structures.h>
+
+#include "../Helpers/foleys_IdentifierHash.h"
+
+namespace foleys
+{
+
+class Stylesheet;
+
+/**
+ ResolvedStyles holds style properties for a whole GUI tree, that were resolved before the GuiItems
+ are created. The resolving is done on a pool of worker threads, so the message thread only needs
+ to create the components and finds the styles of a node in a lookup instead of searching the
+ stylesheet. The lookup is keyed by the identity of the node, so nodes that look alike are told apart.
+
+ The values are only valid for the style generation they were resolved for.
+ */
+class ResolvedStyles
+{
+public:
+    using PropertiesPerType = std::unordered_map<juce::Identifier, juce::Array<juce::Identifier>, IdentifierHash>;
+
+    ResolvedStyles() = default;
+
+    /**
+     Resolves the properties of all nodes in the tree. This blocks until all nodes are resolved,
+     the calling thread will resolve nodes as well.
+
+     @param stylesheet the stylesheet to resolve the properties from
+     @param tree the GUI tree to resolve
+     @param properties the type specific properties, that are resolved in addition to getCommonProperties()
+     @param pool the ThreadPool to help resolving
+     */
+    void resolve (const Stylesheet& stylesheet, const juce::ValueTree& tree, const PropertiesPerType& properties, juce::ThreadPool& pool);
+
+    /**
+     Returns the resolved value, or nullptr, if the property was not resolved for that node
+     */
+    const juce::var* find (const juce::Identifier& name, const juce::ValueTree& node) const;
+
+    /**
+     Returns the style generation the values were resolved for
+     */
+    juce::uint32 getStyleGeneration() const { return styleGeneration; }
+
+    bool isEmpty() const { return records.empty(); }
+
+    void clear();
+
+    /**
+     The properties every GuiItem reads to configure the decorator, the component, the flex item and its position
+     */
+    static juce::Array<juce::Identifier> getCommonProperties();
+
+    /**
+     The properties a Container reads in addition to the common ones
+     */
+    static juce::Array<juce::Identifier> getContainerProperties();
+
+private:
+    struct Record
+    {
+        juce::ValueTree     node;
+        juce::NamedValueSet properties;
+    };
+
+    /**
+     The shared object of a ValueTree has no public accessor, but its properties live in it.
+     The records keep the nodes alive, so the address isn't reused while it is in the lookup.
+     */
+    static const void* getIdentity (const juce::ValueTree& node) { return &node.getProperties(); }
+
+    void collectNodes (const juce::ValueTree& node);
+    const Record* findRecord (const juce::ValueTree& node) const;
+    void resolveRecord (Record& record, const Stylesheet& stylesheet, const PropertiesPerType& properties) const;
+
+    std::vector<Record>                     records;
+    std::unordered_map<const void*, size_t> recordIndices;
+    juce::uint32                            styleGeneration = 0;
+
+    // the GuiItems read all properties of one node in a row
+    mutable juce::ValueTree lastNode;
+    mutable const Record*   lastRecord = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ResolvedStyles)
+};
+
+} // namespace foleys
@@ -44,19 +44,48 @@ RootItem::RootItem (MagicGUIBuilder& builder, juce::ValueTree node)
 
 void RootItem::updateColours()
 {
-    auto text = magicBuilder.getStyleProperty (IDs::tooltipText, configNode);
-    if (! text.isVoid())
-        tooltip.getLookAndFeel().setColour (juce::TooltipWindow::textColourId, Stylesheet::parseColour (text));
-    auto background = magicBuilder.getStyleProperty (IDs::tooltipBackground, configNode);
-    if (! background.isVoid())
-        tooltip.getLookAndFeel().setColour (juce::TooltipWindow::backgroundColourId, Stylesheet::parseColour (background));
-    auto outline = magicBuilder.getStyleProperty (IDs::tooltipOutline, configNode);
-    if (! outline.isVoid())
-        tooltip.getLookAndFeel().setColour (juce::TooltipWindow::outlineColourId, Stylesheet::parseColour (outline));
+    setTooltipColour (IDs::tooltipText, juce::TooltipWindow::textColourId);
+    setTooltipColour (IDs::tooltipBackground, juce::TooltipWindow::backgroundColourId);
+    setTooltipColour (IDs::tooltipOutline, juce::TooltipWindow::outlineColourId);
 
     for (const auto& child : *this)
         child->updateColours();
 }
 
+void RootItem::setTooltipColour (const juce::Identifier& property, int colourId)
+{
+    auto colour = magicBuilder.getStyleProperty (property, configNode);
+    if (colour.isVoid())
+        tooltip.removeColour (colourId);
+    else
+        tooltip.setColour (colourId, Stylesheet::parseColour (colour));
+}
+
+juce::String RootItem::Tooltip::getTipFor (juce::Component& component)
+{
+    tipText = juce::TooltipWindow::getTipFor (component);
+    return tipText;
+}
+
+void RootItem::Tooltip::paint (juce::Graphics& g)
+{
+    auto& lookAndFeel = getLookAndFeel();
+    std::vector<std::pair<int, juce::Colour>> lentColours;
+
+    for (auto colourId : { textColourId, backgroundColourId, outlineColourId })
+    {
+        if (isColourSpecified (colourId))
+        {
+            lentColours.emplace_back (colourId, lookAndFeel.findColour (colourId));
+            lookAndFeel.setColour (colourId, findColour (colourId));
+        }
+    }
+
+    lookAndFeel.drawTooltip (g, tipText, getWidth(), getHeight());
+
+    for (const auto& colour : lentColours)
+        lookAndFeel.setColour (colour.first, colour.second);
+}
+
 
 } // namespace foleys
@@ -48,8 +48,26 @@ public:
     void updateColours() override;
 
 private:
-    
-    juce::TooltipWindow tooltip { this };
+    void setTooltipColour (const juce::Identifier& property, int colourId);
+
+    /**
+     The stylesheet colours are set to the TooltipWindow, because the LookAndFeels are shared by all
+     editors. drawTooltip() reads the colours from the LookAndFeel though, so they are lent to it while painting.
+     */
+    class Tooltip : public juce::TooltipWindow
+    {
+    public:
+        using juce::TooltipWindow::TooltipWindow;
+
+        juce::String getTipFor (juce::Component& component) override;
+        void paint (juce::Graphics& g) override;
+
+    private:
+        // the TooltipWindow keeps the text it shows private, this is the same text
+        juce::String tipText;
+    };
+
+    Tooltip tooltip { this };
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RootItem)
     
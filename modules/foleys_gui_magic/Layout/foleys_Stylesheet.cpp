@@ -54,6 +54,7 @@ void Stylesheet::setStyle (const juce::ValueTree& node)
 {
     currentStyle = node;
     setColourPalette();
+    invalidateStyleCache();
 }
 
 bool Stylesheet::setMediaSize (int width, int height)
@@ -107,6 +108,8 @@ juce::ValueTree Stylesheet::getCurrentPalette()
 
 void Stylesheet::valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier& name)
 {
+    invalidateStyleCache();
+
     if (name.toString().contains("color"))
         builder.updateColours();
     else
@@ -116,6 +119,7 @@ void Stylesheet::valueTreePropertyChanged (juce::ValueTree&, const juce::Identif
 void Stylesheet::updateValidRanges()
 {
     validMediaRanges = Stylesheet::SizeRange();
+    invalidateStyleCache();
 
     for (const auto& styleClass : styleClasses)
     {
@@ -140,6 +144,7 @@ void Stylesheet::updateValidRanges()
 void Stylesheet::updateStyleClasses()
 {
     styleClasses.clear();
+    invalidateStyleCache();
 
     for (const auto& styleNode : currentStyle.getChildWithName (IDs::classes))
     {
@@ -266,12 +271,12 @@ juce::LookAndFeel* Stylesheet::getLookAndFeel (const juce::ValueTree& node) cons
         return nullptr;
 
     auto lnf = lnfNode.toString();
-    if (lnf.isNotEmpty())
-    {
-        const auto& it = lookAndFeels.find (lnf);
-        if (it != lookAndFeels.end())
-            return it->second.get();
-    }
+    if (lnf.isEmpty())
+        return nullptr;
+
+    const auto& it = lookAndFeels.find (juce::Identifier (lnf));
+    if (it != lookAndFeels.end())
+        return it->second;
 
     return nullptr;
 }
@@ -280,8 +285,9 @@ juce::StringArray Stylesheet::getLookAndFeelNames() const
 {
     juce::StringArray names;
     for (const auto& it : lookAndFeels)
-        names.add (it.first);
+        names.add (it.first.toString());
 
+    names.sort (true);
     return names;
 }
 
@@ -321,15 +327,35 @@ void Stylesheet::deleteStyleClass (const juce::String& name, juce::UndoManager*
 
 void Stylesheet::registerLookAndFeel (juce::String name, std::unique_ptr<juce::LookAndFeel> lookAndFeel)
 {
+    if (addLookAndFeel (name, lookAndFeel.get()))
+        ownedLookAndFeels.push_back (std::move (lookAndFeel));
+}
+
+void Stylesheet::registerSharedLookAndFeel (juce::String name, juce::LookAndFeel& lookAndFeel)
+{
+    addLookAndFeel (name, &lookAndFeel);
+}
+
+bool Stylesheet::addLookAndFeel (const juce::String& name, juce::LookAndFeel* lookAndFeel)
+{
+    if (name.isEmpty())
+    {
+        // A LookAndFeel needs a name to be referenced in the stylesheet
+        jassertfalse;
+        return false;
+    }
+
     if (lookAndFeels.find (name) != lookAndFeels.cend())
     {
         // You tried to register more than one LookAndFeel with the same name!
         // That cannot work, the second LookAndFeel will be ignored
         jassertfalse;
-        return;
+        return false;
     }
 
-    lookAndFeels [name] = std::move (lookAndFeel);
+    lookAndFeels [name] = lookAndFeel;
+    invalidateStyleCache();
+    return true;
 }
 
 bool Stylesheet::isClassNode (const juce::ValueTree& node) const
@@ -418,8 +444,9 @@ bool Stylesheet::StyleClass::isValidForSize (int width, int height) const
 
 bool Stylesheet::StyleClass::isActive() const
 {
-    return activeFlag.getValue();
+    return active;
 }
+
 Stylesheet::SizeRange Stylesheet::StyleClass::getValidSizeRange() const
 {
     return validRange;
@@ -429,10 +456,12 @@ void Stylesheet::StyleClass::setActiveProperty (juce::Value& source)
 {
     activeFlag.referTo (source);
     activeFlag.addListener (this);
+    active = activeFlag.getValue();
 }
 
 void Stylesheet::StyleClass::valueChanged (juce::Value&)
 {
+    active = activeFlag.getValue();
     sendChangeMessage();
 }
 
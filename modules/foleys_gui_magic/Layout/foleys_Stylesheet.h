@@ -35,6 +35,8 @@
 
 #include <juce_data_structures/juce_data_structures.h>
 
+#include "../Helpers/foleys_IdentifierHash.h"
+
 namespace foleys
 {
 
@@ -107,6 +109,18 @@ public:
      */
     juce::LookAndFeel* getLookAndFeel (const juce::ValueTree& node) const;
 
+    /**
+     The style generation changes whenever anything happened, that can change the result of a
+     style lookup. GuiItems use it to keep resolved values like the LookAndFeel until it changes.
+     */
+    juce::uint32 getStyleGeneration() const { return styleGeneration; }
+
+    /**
+     Call this when a change outside the stylesheet can affect the style lookup, e.g. when
+     a node in the GUI tree got a new id or class.
+     */
+    void invalidateStyleCache() { ++styleGeneration; }
+
     /**
      Finds a background image for the given node. Note that this will only return anything
      useful, if you have added any actual images into the BinaryData and have enabled the
@@ -156,6 +170,14 @@ public:
      */
     void registerLookAndFeel (juce::String name, std::unique_ptr<juce::LookAndFeel> lookAndFeel);
 
+    /**
+     Register a LookAndFeel, that is owned elsewhere, e.g. by the LookAndFeelRegistry.
+
+     @param name the name the LookAndFeel can be referenced in the GUI editor
+     @param lookAndFeel the LookAndFeel, which needs to outlive the Stylesheet and all Components using it
+     */
+    void registerSharedLookAndFeel (juce::String name, juce::LookAndFeel& lookAndFeel);
+
     juce::StringArray getAllClassesNames() const;
 
     juce::StringArray getLookAndFeelNames() const;
@@ -201,7 +223,10 @@ private:
 
         juce::ValueTree styleNode;
 
+        // the flag is copied on the message thread, so resolving styles on worker threads doesn't
+        // read the state, which setStateInformation can write at the same time
         juce::Value activeFlag { true };
+        bool        active     { true };
 
         SizeRange   validRange;
         bool        recursive  { false };
@@ -212,7 +237,10 @@ private:
     juce::ValueTree   currentStyle;
     juce::ValueTree   currentPalette;
 
-    std::map<juce::String, std::unique_ptr<juce::LookAndFeel>> lookAndFeels;
+    bool addLookAndFeel (const juce::String& name, juce::LookAndFeel* lookAndFeel);
+
+    std::unordered_map<juce::Identifier, juce::LookAndFeel*, IdentifierHash> lookAndFeels;
+    std::vector<std::unique_ptr<juce::LookAndFeel>>                          ownedLookAndFeels;
     std::map<juce::String, std::unique_ptr<StyleClass>> styleClasses;
 
     int mediaWidth = 0;
@@ -220,6 +248,8 @@ private:
 
     SizeRange validMediaRanges;
 
+    juce::uint32 styleGeneration = 1;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Stylesheet)
 };
 
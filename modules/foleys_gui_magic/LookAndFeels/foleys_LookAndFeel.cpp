@@ -36,6 +36,35 @@
 namespace foleys
 {
 
+LookAndFeel::RotaryGeometry LookAndFeel::getRotaryGeometry (juce::Rectangle<int> area)
+{
+    RotaryGeometry geometry;
+    geometry.bounds = area.toFloat().reduced (10);
+
+    auto radius = juce::jmin (geometry.bounds.getWidth() / 2.0f, geometry.bounds.getHeight() / 2.0f);
+
+    geometry.hasTickLabels = radius > tickWidth * 2.0f + 10.0f;
+    geometry.labelBounds   = geometry.bounds;
+    if (geometry.hasTickLabels)
+    {
+        geometry.bounds.removeFromTop (tickHeight + 4.0f);
+        geometry.bounds.reduce (tickWidth, 0.0f);
+    }
+
+    radius = juce::jmin (geometry.bounds.getWidth() / 2.0f, geometry.bounds.getHeight() / 2.0f);
+
+    geometry.hasTickDots = radius > 50.0f;
+    geometry.dotRadius   = radius - 2.0f;
+    if (geometry.hasTickDots)
+        radius -= 10.0f;
+
+    geometry.centre     = geometry.bounds.getCentre();
+    geometry.lineW      = juce::jmin (4.0f, radius * 0.5f);
+    geometry.arcRadius  = radius - geometry.lineW;
+    geometry.knobRadius = std::max (radius - 3.0f * geometry.lineW, 10.0f);
+    return geometry;
+}
+
 void LookAndFeel::drawRotarySlider (juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
                                     const float rotaryStartAngle, const float rotaryEndAngle, juce::Slider& slider)
 {
@@ -43,56 +72,101 @@ void LookAndFeel::drawRotarySlider (juce::Graphics& g, int x, int y, int width,
     const auto fill    = slider.findColour (juce::Slider::rotarySliderFillColourId);
     const auto text    = slider.findColour (juce::Slider::textBoxTextColourId);
 
-    auto bounds = juce::Rectangle<int> (x, y, width, height).toFloat().reduced (10);
-    auto centre = bounds.getCentre();
+    const auto area     = juce::Rectangle<int> (x, y, width, height);
+    const auto geometry = getRotaryGeometry (area);
+
+    // the labels, ticks, background arc and knob don't depend on the value. The labels are keyed by
+    // their text, since custom formatting (e.g. of a parameter attachment) can't be compared otherwise
+    juce::StringArray labels;
+    if (geometry.hasTickLabels)
+        for (auto proportion : { 0.5f, 0.375f, 0.25f, 0.125f, 0.0f, 0.625f, 0.75f, 0.875f, 1.0f })
+            labels.add (slider.getTextFromValue (slider.proportionOfLengthToValue (proportion)));
+
+    LayerCache::Key key;
+    key.add (outline).add (text).add (slider.isEnabled()).add (rotaryStartAngle).add (rotaryEndAngle);
+
+    // the terminator keeps "1", "23" apart from "12", "3"
+    for (const auto& label : labels)
+        key.add (label).add (0);
 
-    const auto tickHeight = 6;
-    const auto tickWidth  = 40;
+    rotaryLayers.draw (g, area, key, [&] (juce::Graphics& layer)
+    {
+        drawRotaryBackground (layer, getRotaryGeometry (area.withZeroOrigin()), labels, rotaryStartAngle, rotaryEndAngle, outline, text, slider.isEnabled());
+    });
+
+    const auto centre = geometry.centre;
+    const auto lineW  = geometry.lineW;
+    const auto toAngle = rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
+    const auto knobRadius = std::max (geometry.knobRadius - 4.0f, 10.0f);
+
+    g.setColour (outline.brighter());
+
+    if (slider.isEnabled() && geometry.arcRadius > 10.0f)
+    {
+        juce::Path valueArc;
+        valueArc.addCentredArc (centre.getX(),
+                                centre.getY(),
+                                geometry.arcRadius,
+                                geometry.arcRadius,
+                                0.0f,
+                                rotaryStartAngle,
+                                toAngle,
+                                true);
 
-    auto radius = juce::jmin (bounds.getWidth() / 2.0f, bounds.getHeight() / 2.0f);
+        g.setColour (fill);
+        g.strokePath (valueArc, juce::PathStrokeType (lineW, juce::PathStrokeType::curved, juce::PathStrokeType::butt));
+    }
+
+    juce::Path p;
+    p.startNewSubPath (centre.getPointOnCircumference (knobRadius - lineW, toAngle));
+    p.lineTo (centre.getPointOnCircumference ((knobRadius - lineW) * 0.6f, toAngle));
+    g.strokePath (p, juce::PathStrokeType (lineW, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+}
+
+void LookAndFeel::drawRotaryBackground (juce::Graphics& g, const RotaryGeometry& geometry, const juce::StringArray& labels,
+                                        float rotaryStartAngle, float rotaryEndAngle,
+                                        juce::Colour outline, juce::Colour text, bool isEnabled)
+{
+    const auto& bounds = geometry.labelBounds;
+    const auto  centre = geometry.centre;
+    const auto  lineW  = geometry.lineW;
 
     g.setColour (text);
-    if (radius > tickWidth * 2.0f + 10.0f)
+    if (geometry.hasTickLabels && labels.size() == 9)
     {
         const auto xLeft  = int (bounds.getX());
         const auto xRight = int (bounds.getRight() - tickWidth);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.5f)),   int (centre.getX() - tickWidth / 2), int (bounds.getY()), tickWidth, tickHeight, juce::Justification::centred, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.375f)), xLeft,  int (bounds.getY()), tickWidth, tickHeight, juce::Justification::left, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.25f)),  xLeft,  int (juce::jmap (0.33f,  float (bounds.getY()), bounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::left, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.125f)), xLeft,  int (juce::jmap (0.66f,  float (bounds.getY()), bounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::left, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.0f)),   xLeft,  int (bounds.getBottom() - tickHeight), tickWidth, tickHeight, juce::Justification::left, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.625f)), xRight, int (bounds.getY()), tickWidth, tickHeight, juce::Justification::right, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.75f)),  xRight, int (juce::jmap (0.33f,  float (bounds.getY()), bounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::right, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (0.875f)), xRight, int (juce::jmap (0.66f,  float (bounds.getY()), bounds.getBottom() - tickHeight)), tickWidth, tickHeight, juce::Justification::right, 1);
-        g.drawFittedText (slider.getTextFromValue (slider.proportionOfLengthToValue (1.0f)),   xRight, int (bounds.getBottom() - tickHeight), tickWidth, tickHeight, juce::Justification::right, 1);
-
-        bounds.removeFromTop (tickHeight + 4.0f);
-        bounds.reduce (tickWidth, 0.0f);
+        const auto yTop   = int (bounds.getY());
+        const auto yUpper = int (juce::jmap (0.33f, float (bounds.getY()), bounds.getBottom() - tickHeight));
+        const auto yLower = int (juce::jmap (0.66f, float (bounds.getY()), bounds.getBottom() - tickHeight));
+        const auto yBottom = int (bounds.getBottom() - tickHeight);
+
+        g.drawFittedText (labels [0], int (bounds.getCentreX() - tickWidth / 2), yTop, tickWidth, tickHeight, juce::Justification::centred, 1);
+        g.drawFittedText (labels [1], xLeft,  yTop,    tickWidth, tickHeight, juce::Justification::left, 1);
+        g.drawFittedText (labels [2], xLeft,  yUpper,  tickWidth, tickHeight, juce::Justification::left, 1);
+        g.drawFittedText (labels [3], xLeft,  yLower,  tickWidth, tickHeight, juce::Justification::left, 1);
+        g.drawFittedText (labels [4], xLeft,  yBottom, tickWidth, tickHeight, juce::Justification::left, 1);
+        g.drawFittedText (labels [5], xRight, yTop,    tickWidth, tickHeight, juce::Justification::right, 1);
+        g.drawFittedText (labels [6], xRight, yUpper,  tickWidth, tickHeight, juce::Justification::right, 1);
+        g.drawFittedText (labels [7], xRight, yLower,  tickWidth, tickHeight, juce::Justification::right, 1);
+        g.drawFittedText (labels [8], xRight, yBottom, tickWidth, tickHeight, juce::Justification::right, 1);
     }
 
-    radius = juce::jmin (bounds.getWidth() / 2.0f, bounds.getHeight() / 2.0f);
-    centre = bounds.getCentre();
-
-    if (radius > 50.0f)
+    if (geometry.hasTickDots)
     {
         for (int i = 0; i < 9; ++i)
         {
             const auto angle = juce::jmap (i / 8.0f, rotaryStartAngle, rotaryEndAngle);
-            const auto point = centre.getPointOnCircumference (radius - 2.0f, angle);
+            const auto point = centre.getPointOnCircumference (geometry.dotRadius, angle);
             g.fillEllipse (point.getX() - 3, point.getY() - 3, 6, 6);
         }
-        radius -= 10.0f;
     }
 
-    auto toAngle = rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
-    auto lineW = juce::jmin (4.0f, radius * 0.5f);
-    auto arcRadius  = radius - lineW;
-
     juce::Path backgroundArc;
-    backgroundArc.addCentredArc (bounds.getCentreX(),
-                                 bounds.getCentreY(),
-                                 arcRadius,
-                                 arcRadius,
+    backgroundArc.addCentredArc (centre.getX(),
+                                 centre.getY(),
+                                 geometry.arcRadius,
+                                 geometry.arcRadius,
                                  0.0f,
                                  rotaryStartAngle,
                                  rotaryEndAngle,
@@ -101,10 +175,10 @@ void LookAndFeel::drawRotarySlider (juce::Graphics& g, int x, int y, int width,
     g.setColour (outline);
     g.strokePath (backgroundArc, juce::PathStrokeType (lineW, juce::PathStrokeType::curved, juce::PathStrokeType::butt));
 
-    auto knobRadius = std:: max (radius - 3.0f * lineW, 10.0f);
+    auto knobRadius = geometry.knobRadius;
     {
         juce::Graphics::ScopedSaveState saved (g);
-        if (slider.isEnabled())
+        if (isEnabled)
         {
             juce::ColourGradient fillGradient (outline.brighter(), centre.getX() + lineW * 2.0f, centre.getY() - lineW * 4.0f, outline, centre.getX() + knobRadius, centre.getY() + knobRadius, true);
             g.setGradientFill (fillGradient);
@@ -112,30 +186,9 @@ void LookAndFeel::drawRotarySlider (juce::Graphics& g, int x, int y, int width,
         g.fillEllipse (centre.getX() - knobRadius, centre.getY() - knobRadius, knobRadius * 2.0f, knobRadius * 2.0f);
     }
 
-    knobRadius = std:: max (knobRadius - 4.0f, 10.0f);
+    knobRadius = std::max (knobRadius - 4.0f, 10.0f);
     g.setColour (outline.brighter());
     g.drawEllipse (centre.getX() - knobRadius, centre.getY() - knobRadius, knobRadius * 2.0f, knobRadius * 2.0f, 2.0f);
-
-    if (slider.isEnabled() && arcRadius > 10.0f)
-    {
-        juce::Path valueArc;
-        valueArc.addCentredArc (bounds.getCentreX(),
-                                bounds.getCentreY(),
-                                arcRadius,
-                                arcRadius,
-                                0.0f,
-                                rotaryStartAngle,
-                                toAngle,
-                                true);
-
-        g.setColour (fill);
-        g.strokePath (valueArc, juce::PathStrokeType (lineW, juce::PathStrokeType::curved, juce::PathStrokeType::butt));
-    }
-
-    juce::Path p;
-    p.startNewSubPath (centre.getPointOnCircumference (knobRadius - lineW, toAngle));
-    p.lineTo (centre.getPointOnCircumference ((knobRadius - lineW) * 0.6f, toAngle));
-    g.strokePath (p, juce::PathStrokeType (lineW, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
 }
 
 //==============================================================================
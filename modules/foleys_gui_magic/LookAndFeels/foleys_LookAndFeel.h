@@ -57,8 +57,32 @@ public:
     //==============================================================================
 
     void drawTabButton (juce::TabBarButton&, juce::Graphics&, bool isMouseOver, bool isMouseDown) override;
-    
+
 private:
+    static constexpr int tickHeight = 6;
+    static constexpr int tickWidth  = 40;
+
+    struct RotaryGeometry
+    {
+        juce::Rectangle<float> labelBounds;
+        juce::Rectangle<float> bounds;
+        juce::Point<float>     centre;
+        float                  dotRadius  = 0.0f;
+        float                  lineW      = 0.0f;
+        float                  arcRadius  = 0.0f;
+        float                  knobRadius = 0.0f;
+        bool                   hasTickLabels = false;
+        bool                   hasTickDots   = false;
+    };
+
+    static RotaryGeometry getRotaryGeometry (juce::Rectangle<int> area);
+
+    void drawRotaryBackground (juce::Graphics& g, const RotaryGeometry& geometry, const juce::StringArray& labels,
+                               float rotaryStartAngle, float rotaryEndAngle,
+                               juce::Colour outline, juce::Colour text, bool isEnabled);
+
+    // labels, ticks, background arc and knob body, rendered once per size and scale
+    LayerCache rotaryLayers;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LookAndFeel)
 };
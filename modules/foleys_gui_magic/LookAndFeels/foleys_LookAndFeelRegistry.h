@@ -0,0 +1,75 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include "../Helpers/foleys_IdentifierHash.h"
+
+namespace foleys
+{
+
+/**
+ The LookAndFeelRegistry keeps LookAndFeels, that are shared by all editors in the process.
+ Most LookAndFeels don't keep any state of a particular plugin instance, so there is no need
+ to create them again for each editor. Use it through the SharedLookAndFeelRegistry, which is
+ reference counted, so the LookAndFeels are deleted when the last MagicGUIBuilder is gone.
+ All methods are meant to be called on the message thread.
+ */
+class LookAndFeelRegistry
+{
+public:
+    using Factory = std::function<std::unique_ptr<juce::LookAndFeel>()>;
+
+    LookAndFeelRegistry() = default;
+
+    /**
+     Returns the LookAndFeel registered with that name. The factory is only called, if there is none yet.
+     */
+    juce::LookAndFeel& getOrCreate (const juce::Identifier& name, const Factory& factory);
+
+    /**
+     Returns the LookAndFeel registered with that name, or nullptr if none was created yet
+     */
+    juce::LookAndFeel* find (const juce::Identifier& name) const;
+
+private:
+    std::unordered_map<juce::Identifier, std::unique_ptr<juce::LookAndFeel>, IdentifierHash> lookAndFeels;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LookAndFeelRegistry)
+};
+
+using SharedLookAndFeelRegistry = juce::SharedResourcePointer<LookAndFeelRegistry>;
+
+} // namespace foleys
@@ -71,26 +71,16 @@ static inline void fillEllipse (juce::Graphics& g, const juce::Rectangle<float>&
     g.fillEllipse (bounds);
 }
 
-const Skeuomorphic::knobImages& Skeuomorphic::getKnobImages (int diameter)
+void Skeuomorphic::paintKnobBackground (juce::Graphics& g, int diameter) const
 {
-    auto search = knobsBgs.find (diameter);
-    if (search != knobsBgs.end()) return search->second;
-
     float radius = diameter * 0.5f;
     bool isTiny  = diameter < 20;
-    bool isSmall = diameter < 60;
 
     juce::Point<float>     centre { radius, radius };
     juce::Rectangle<float> bounds { 0.0f, 0.0f, float (diameter), float (diameter) };
 
-    if (knobsBgs.size() > size_t (knobsMaxSize))
-        knobsBgs.clear();
-
-
     // background
-    juce::Image bg { juce::Image::ARGB, diameter, diameter + 3, true };
     {
-        juce::Graphics g (bg);
         fillEllipse (g, bounds.translated (0.0f, 1.0f), whiteA010);
         fillEllipse (g, bounds.translated (0.0f, 2.0f), whiteA010);
         fillEllipse (g, bounds,                         { 50, 51, 61});
@@ -107,16 +97,22 @@ const Skeuomorphic::knobImages& Skeuomorphic::getKnobImages (int diameter)
                                                   { 1.0,                          blackA092 } });
         fillEllipse (g, bounds, backgroundGr);
     }
+}
 
+void Skeuomorphic::paintKnobForeground (juce::Graphics& g, int diameter) const
+{
+    float radius = diameter * 0.5f;
+    bool isSmall = diameter < 60;
+
+    juce::Point<float>     centre { radius, radius };
+    juce::Rectangle<float> bounds { 0.0f, 0.0f, float (diameter), float (diameter) };
 
     bounds.reduce (diameter * 0.15f, diameter * 0.15f);
     auto fgRadius = bounds.getWidth() * 0.5f;
 
-
     // foreground
-    juce::Image fg { juce::Image::ARGB, diameter, diameter, true };
     {
-        juce::Graphics g (fg); // lower shadow
+        // lower shadow
         {
             auto xOffset = fgRadius * 0.12f;
             auto yOffset = fgRadius * 0.32f;
@@ -154,9 +150,6 @@ const Skeuomorphic::knobImages& Skeuomorphic::getKnobImages (int diameter)
             g.drawEllipse (bounds, 1.0f);
         }
     }
-
-    knobsBgs.insert ({diameter, knobImages { std::move (bg), std::move (fg) }});
-    return knobsBgs.find (diameter)->second;
 }
 
 void Skeuomorphic::drawRotarySlider (juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
@@ -180,8 +173,10 @@ void Skeuomorphic::drawRotarySlider (juce::Graphics& g, int x, int y, int width,
 
     const juce::Colour fill = slider.findColour (juce::Slider::rotarySliderFillColourId);
 
-    const knobImages& images = getKnobImages (diameter);
-    g.drawImageAt (images.backgroundImage, x, y);
+    knobLayers.draw (g, { x, y, diameter, diameter + 3 }, LayerCache::Key().add (0), [this, diameter] (juce::Graphics& layer)
+    {
+        paintKnobBackground (layer, diameter);
+    });
 
     if (!isSmall) // marker dot
     {
@@ -241,7 +236,13 @@ void Skeuomorphic::drawRotarySlider (juce::Graphics& g, int x, int y, int width,
     g.drawEllipse (bounds, 1.0f);
 
     g.setColour (juce::Colours::black);
-    if (!isTiny) g.drawImageAt (images.foregroundImage, x, y);
+    if (!isTiny)
+    {
+        knobLayers.draw (g, { x, y, diameter, diameter }, LayerCache::Key().add (1), [this, diameter] (juce::Graphics& layer)
+        {
+            paintKnobForeground (layer, diameter);
+        });
+    }
 }
 
 } // namespace foleys
@@ -47,17 +47,8 @@ public:
                            float rotaryEndAngle, juce::Slider&) override;
 
 private:
-    struct knobImages
-    {
-        knobImages (juce::Image bg, juce::Image fg) : backgroundImage {bg}, foregroundImage {fg} {}
-        knobImages (const knobImages& src) = default;
-        knobImages (knobImages&& src) = default;
-
-        juce::Image backgroundImage;
-        juce::Image foregroundImage;
-    };
-    std::map<int, knobImages> knobsBgs;
-    int knobsMaxSize {6};
+    // the knob body is rendered once per diameter and physical scale
+    LayerCache knobLayers;
 
     // hardcoded colors for the knobs
     const juce::Colour whiteA010 = juce::Colours::white.withAlpha (juce::uint8 ( 10));
@@ -67,7 +58,8 @@ private:
     const juce::Colour blackA122 = juce::Colours::black.withAlpha (juce::uint8 (122));
     const juce::Colour blackA142 = juce::Colours::black.withAlpha (juce::uint8 (142));
 
-    const knobImages& getKnobImages (int diameter);
+    void paintKnobBackground (juce::Graphics& g, int diameter) const;
+    void paintKnobForeground (juce::Graphics& g, int diameter) const;
 
 private:    
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Skeuomorphic)
@@ -32,28 +32,87 @@
  */
 
 #include "foleys_MagicGUIState.h"
+#include "../Visualisers/foleys_MagicLevelSource.h"
 
 namespace foleys
 {
 
 MagicGUIState::MagicGUIState()
 {
+    state.addListener (this);
 }
 
 MagicGUIState::~MagicGUIState()
 {
-    visualiserThread.stopThread (1000);
+    cancelPendingUpdate();
+    state.removeListener (this);
+    propertyMirrors.clear();
+
+    visualiserPool->removeJobsOf (this);
 }
 
 void MagicGUIState::addBackgroundProcessing (MagicPlotSource* source)
 {
-    if (auto* job = source->getBackgroundJob())
+    auto* job = source->getBackgroundJob();
+    if (job == nullptr)
+        return;
+
+    // the job is suspended while the source doesn't process
+    source->onProcessingChanged = [this, job] (bool isProcessing)
+    {
+        if (isProcessing)
+            visualiserPool->addJob (job, this);
+        else
+            visualiserPool->removeJob (job);
+    };
+
+    if (source->isProcessing())
+        source->onProcessingChanged (true);
+}
+
+void MagicGUIState::addedObject (ObjectBase& object)
+{
+    if (auto* plot = dynamic_cast<MagicPlotSource*>(&object))
+    {
+        if (visualisersIdleWithoutConsumers)
+            plot->setIdleWithoutConsumers (true);
+
+        addBackgroundProcessing (plot);
+    }
+    else if (auto* level = dynamic_cast<MagicLevelSource*>(&object))
+    {
+        if (visualisersIdleWithoutConsumers)
+            level->setIdleWithoutConsumers (true);
+    }
+}
+
+void MagicGUIState::setVisualisersIdleWithoutConsumers (bool shouldIdle)
+{
+    visualisersIdleWithoutConsumers = shouldIdle;
+
+    for (auto& object : advertisedObjects)
     {
-        visualiserThread.addTimeSliceClient (job);
-        visualiserThread.startThread();
+        if (auto* plot = dynamic_cast<MagicPlotSource*>(object.second.get()))
+            plot->setIdleWithoutConsumers (shouldIdle);
+        else if (auto* level = dynamic_cast<MagicLevelSource*>(object.second.get()))
+            level->setIdleWithoutConsumers (shouldIdle);
     }
 }
 
+void MagicGUIState::setEditorVisible (bool isVisible)
+{
+    visualiserPool->setOwnerVisible (this, isVisible);
+}
+
+PlotPathBuilder& MagicGUIState::getPlotPathBuilder (MagicPlotSource& source)
+{
+    auto& builder = plotPathBuilders [&source];
+    if (builder == nullptr)
+        builder = std::make_unique<PlotPathBuilder> (source, this);
+
+    return *builder;
+}
+
 void MagicGUIState::addTrigger (const juce::Identifier& triggerID, std::function<void()> function)
 {
     triggers [triggerID] = function;
@@ -83,6 +142,8 @@ void MagicGUIState::setGuiValueTree (const juce::ValueTree& dom)
     jassert (dom.hasType (IDs::magic));
 
     guiValueTree = dom;
+
+    imageCache->preloadImagesReferencedIn (guiValueTree);
 }
 
 void MagicGUIState::setGuiValueTree (const char* data, int dataSize)
@@ -122,22 +183,150 @@ juce::ValueTree& MagicGUIState::getSettings()
 
 juce::Value MagicGUIState::getPropertyAsValue (const juce::String& pathToProperty)
 {
-    auto path = juce::StringArray::fromTokens (pathToProperty, ":", "");
+    if (pathToProperty.isEmpty())
+        return {};
+
+    const auto& resolved = resolvePropertyPath (juce::Identifier (pathToProperty));
+    if (! resolved.node.isValid())
+        return {};
+
+    auto tree = resolved.node;
+    if (!tree.hasProperty (resolved.property))
+        tree.setProperty (resolved.property, {}, nullptr);
+
+    return tree.getPropertyAsValue (resolved.property, nullptr);
+}
+
+const MagicGUIState::ResolvedPropertyPath& MagicGUIState::resolvePropertyPath (const juce::Identifier& key)
+{
+    static const ResolvedPropertyPath invalidPath;
+
+    const auto generation = propertyTreeGeneration.load();
+    if (generation != resolvedPathsGeneration)
+    {
+        resolvedPaths.clear();
+        resolvedPathsGeneration = generation;
+    }
+
+    auto cached = resolvedPaths.find (key);
+    if (cached != resolvedPaths.end())
+        return cached->second;
+
+    auto path = juce::StringArray::fromTokens (key.toString(), ":", "");
     path.removeEmptyStrings();
 
     if (path.size() == 0)
-        return {};
+        return invalidPath;
 
     auto tree = getPropertyRoot();
 
     for (int i = 0; i < path.size() - 1 && tree.isValid(); ++i)
         tree = tree.getOrCreateChildWithName (path [i], nullptr);
 
-    auto propName = path [path.size()-1];
-    if (!tree.hasProperty (propName))
-        tree.setProperty (propName, {}, nullptr);
+    return resolvedPaths [key] = { tree, path [path.size()-1] };
+}
+
+juce::ValueTree MagicGUIState::resolveNodePath (const juce::String& pathToNode)
+{
+    auto path = juce::StringArray::fromTokens (pathToNode, ":", "");
+    path.removeEmptyStrings();
 
-    return tree.getPropertyAsValue (propName, nullptr);
+    if (path.size() == 0)
+        return {};
+
+    auto tree = getPropertyRoot();
+
+    for (int i = 0; i < path.size() && tree.isValid(); ++i)
+        tree = tree.getOrCreateChildWithName (path [i], nullptr);
+
+    return tree;
+}
+
+void MagicGUIState::valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int)
+{
+    propertyTreeStructureChanged();
+}
+
+void MagicGUIState::valueTreeChildOrderChanged (juce::ValueTree&, int, int)
+{
+    propertyTreeStructureChanged();
+}
+
+void MagicGUIState::valueTreeRedirected (juce::ValueTree&)
+{
+    propertyTreeStructureChanged();
+}
+
+void MagicGUIState::propertyTreeStructureChanged()
+{
+    ++propertyTreeGeneration;
+
+    // this can be called from setStateInformation on a background thread
+    triggerAsyncUpdate();
+}
+
+juce::ValueTree MagicGUIState::findExistingNode (const juce::Identifier& path, bool isNode) const
+{
+    auto names = juce::StringArray::fromTokens (path.toString(), ":", "");
+    names.removeEmptyStrings();
+
+    auto tree = getPropertyRoot();
+    const auto numNodes = isNode ? names.size() : names.size() - 1;
+
+    for (int i = 0; i < numNodes && tree.isValid(); ++i)
+        tree = tree.getChildWithName (names [i]);
+
+    return tree;
+}
+
+void MagicGUIState::handleAsyncUpdate()
+{
+    rebindOnMessageThread();
+}
+
+void MagicGUIState::rebindProperties()
+{
+    if (juce::MessageManager::existsAndIsCurrentThread())
+    {
+        cancelPendingUpdate();
+        rebindOnMessageThread();
+        return;
+    }
+
+    // the resolved paths and the nodes of the bindings belong to the message thread,
+    // so only the restored values are published here
+    auto finder = [this] (const juce::Identifier& path, bool isNode) { return findExistingNode (path, isNode); };
+
+    {
+        const juce::ScopedLock lock (mirrorLock);
+        for (auto& mirror : propertyMirrors)
+            mirror.second->publish (finder (mirror.first, false));
+    }
+
+    propertyBridge.publish (finder);
+
+    triggerAsyncUpdate();
+}
+
+void MagicGUIState::rebindOnMessageThread()
+{
+    {
+        const juce::ScopedLock lock (mirrorLock);
+        for (auto& mirror : propertyMirrors)
+        {
+            if (mirror.second->getNode().isAChildOf (state))
+                continue;
+
+            const auto& resolved = resolvePropertyPath (mirror.first);
+            if (resolved.node.isValid())
+                mirror.second->referTo (resolved.node);
+        }
+    }
+
+    propertyBridge.rebind ([this] (const juce::Identifier& path, bool isNode)
+    {
+        return isNode ? resolveNodePath (path.toString()) : resolvePropertyPath (path).node;
+    });
 }
 
 juce::StringArray MagicGUIState::getParameterNames() const
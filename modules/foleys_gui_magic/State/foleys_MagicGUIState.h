@@ -36,7 +36,13 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 
 #include "../Visualisers/foleys_MagicPlotSource.h"
+#include "../Visualisers/foleys_VisualiserWorkerPool.h"
+#include "../Visualisers/foleys_PlotPathBuilder.h"
 #include "../General/foleys_StringDefinitions.h"
+#include "../General/foleys_ImageAssetCache.h"
+#include "../Helpers/foleys_IdentifierHash.h"
+#include "../Helpers/foleys_PropertyMirror.h"
+#include "foleys_PropertyBridge.h"
 
 namespace foleys
 {
@@ -47,7 +53,8 @@ namespace foleys
  It is also the place, where the data for the visualisers is sent to, which are
  MagicPlotSources and MagicLevelSources.
  */
-class MagicGUIState
+class MagicGUIState : private juce::ValueTree::Listener,
+                      private juce::AsyncUpdater
 {
     struct ObjectBase {
         virtual ~ObjectBase() noexcept = default;
@@ -67,7 +74,7 @@ class MagicGUIState
 public:
     MagicGUIState();
 
-    virtual ~MagicGUIState();
+    ~MagicGUIState() override;
 
     /**
      Returns the root node for exposed properties for the GUI
@@ -135,6 +142,97 @@ public:
      */
     juce::Value getPropertyAsValue (const juce::String& pathToProperty);
 
+    /**
+     Returns a lock-free mirror of a property inside the ValueTreeState. The mirror is owned by the
+     MagicGUIState and is updated synchronously each time the property is set. This allows the audio
+     thread to read GUI properties without going through juce::Value.
+     Call this on the message thread, the returned mirror can be read from any thread.
+
+     @param pathToProperty is a colon separated list of nodes, the last component is the property name
+     @return the mirror, or a nullptr if the path is invalid or was already mirrored using a different type
+     */
+    template<typename T>
+    PropertyMirror<T>* getPropertyMirror (const juce::String& pathToProperty)
+    {
+        if (pathToProperty.isEmpty())
+            return nullptr;
+
+        const juce::ScopedLock lock (mirrorLock);
+
+        const juce::Identifier key (pathToProperty);
+        auto existing = propertyMirrors.find (key);
+        if (existing != propertyMirrors.end())
+        {
+            // You requested the same property mirrored as a different type
+            jassert (dynamic_cast<PropertyMirror<T>*>(existing->second.get()) != nullptr);
+            return dynamic_cast<PropertyMirror<T>*>(existing->second.get());
+        }
+
+        const auto& resolved = resolvePropertyPath (key);
+        if (! resolved.node.isValid())
+            return nullptr;
+
+        auto mirror = std::make_unique<PropertyMirror<T>>(resolved.property);
+        mirror->referTo (resolved.node);
+
+        auto* pointerToReturn = mirror.get();
+        propertyMirrors [key] = std::move (mirror);
+        return pointerToReturn;
+    }
+
+    /**
+     Binds a property to a slot of the PropertyBridge. The audio thread reads the value using
+     the returned handle, either directly via getPropertyBridge().get (handle) or from a
+     PropertyBridge::Snapshot. Bindings survive restoring the state.
+     Call this on the message thread.
+
+     @param pathToProperty is a colon separated list of nodes, the last component is the property name
+     */
+    template<typename T>
+    PropertyBridge::Handle<T> bindProperty (const juce::String& pathToProperty)
+    {
+        if (pathToProperty.isEmpty())
+            return {};
+
+        const juce::Identifier key (pathToProperty);
+        const auto& resolved = resolvePropertyPath (key);
+        if (! resolved.node.isValid())
+            return {};
+
+        return propertyBridge.addBinding<T> (key, resolved.node, resolved.property);
+    }
+
+    /**
+     Binds all properties of a node to a struct, that is published lock-free to the audio thread.
+     The converter creates the struct from the node and is called on the message thread.
+
+     @param pathToNode is a colon separated list of nodes
+     */
+    template<typename T>
+    PropertyBridge::StructHandle<T> bindPropertyNode (const juce::String& pathToNode, std::function<T(const juce::ValueTree&)> converter)
+    {
+        auto node = resolveNodePath (pathToNode);
+        if (! node.isValid())
+            return {};
+
+        return propertyBridge.addStructBinding<T> (juce::Identifier (pathToNode), node, std::move (converter));
+    }
+
+    /**
+     Grants access to the PropertyBridge, to read bound properties from the audio thread.
+     */
+    const PropertyBridge& getPropertyBridge() const { return propertyBridge; }
+
+    /**
+     Connects the PropertyMirrors and PropertyBridge bindings to the nodes of a restored state. This happens
+     automatically, but asynchronously. Call it right after the state was replaced, so the audio thread doesn't
+     read the old values in the meantime. MagicProcessorState::setStateInformation does that for you.
+
+     On the message thread everything is connected right away. Other threads only publish the restored
+     values, connecting the nodes is left to the message thread.
+     */
+    void rebindProperties();
+
     /**
      Populates a menu with properties found in the persistent ValueTree
      */
@@ -164,8 +262,7 @@ public:
         auto* pointerToReturn = o.get();
         advertisedObjects [objectID] = std::move (o);
 
-        if (auto* plot = dynamic_cast<MagicPlotSource*>(pointerToReturn))
-            addBackgroundProcessing (plot);
+        addedObject (*pointerToReturn);
 
         return pointerToReturn;
     }
@@ -206,7 +303,8 @@ public:
      */
     void clearAllObjects()
     {
-        visualiserThread.removeAllClients();
+        visualiserPool->removeJobsOf (this);
+        plotPathBuilders.clear();
         advertisedObjects.clear();
     }
 
@@ -221,6 +319,26 @@ public:
      */
     void addBackgroundProcessing (MagicPlotSource* source);
 
+    /**
+     Let all MagicPlotSources and MagicLevelSources skip their work while no component displays
+     them, also the ones added later. This is off by default, because readers that don't call
+     addConsumer() would get no data. Call this on the message thread.
+     */
+    void setVisualisersIdleWithoutConsumers (bool shouldIdle);
+
+    /**
+     The editor reports here if it is showing, so the background processing of visible
+     editors is preferred in the shared VisualiserWorkerPool.
+     */
+    void setEditorVisible (bool isVisible);
+
+    /**
+     Returns the PlotPathBuilder of a source, which creates the paths for all MagicPlotComponents
+     that draw this source with background paths. It is created on first use and lives as long as
+     the objects of this state.
+     */
+    PlotPathBuilder& getPlotPathBuilder (MagicPlotSource& source);
+
     juce::MidiKeyboardState& getKeyboardState();
 
     /**
@@ -241,11 +359,53 @@ private:
     void addParametersToMenu (const juce::AudioProcessorParameterGroup& group, juce::PopupMenu& menu, int& index) const;
     void addPropertiesToMenu (const juce::ValueTree& tree, juce::ComboBox& combo, juce::PopupMenu& menu, const juce::String& path) const;
 
+    struct ResolvedPropertyPath
+    {
+        juce::ValueTree  node;
+        juce::Identifier property;
+    };
+
+    /**
+     Looks up the node and property name for a colon separated path, creating the nodes if necessary.
+     The result is cached until nodes are removed from the property tree or it is redirected.
+     */
+    const ResolvedPropertyPath& resolvePropertyPath (const juce::Identifier& pathToProperty);
+
+    /**
+     Looks up the node for a colon separated path, creating the nodes if necessary.
+     */
+    juce::ValueTree resolveNodePath (const juce::String& pathToNode);
+
+    /**
+     Looks up the node of a property or the node itself, without creating nodes or touching the cache.
+     This is safe to use from the thread restoring the state.
+     */
+    juce::ValueTree findExistingNode (const juce::Identifier& path, bool isNode) const;
+
+    void rebindOnMessageThread();
+
+    void valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int) override;
+    void valueTreeChildOrderChanged (juce::ValueTree&, int, int) override;
+    void valueTreeRedirected (juce::ValueTree&) override;
+    void propertyTreeStructureChanged();
+
+    void handleAsyncUpdate() override;
+
+    /**
+     Sets up the visualisers amongst the objects added by createAndAddObject
+     */
+    void addedObject (ObjectBase& object);
+
     /**
      The ApplicationSettings is used for settings e.g. over many plugin instances.
      */
     SharedApplicationSettings settings;
 
+    /**
+     Keeps the decoded images alive while this state exists, so editors don't decode again.
+     */
+    SharedImageAssetCache imageCache;
+
     juce::ValueTree guiValueTree { IDs::magic };
     juce::ValueTree state        { "state" };
 
@@ -255,7 +415,19 @@ private:
 
     std::map<juce::Identifier, std::unique_ptr<ObjectBase>> advertisedObjects;
 
-    juce::TimeSliceThread visualiserThread { "Visualiser Thread" };
+    std::unordered_map<juce::Identifier, ResolvedPropertyPath, IdentifierHash>                  resolvedPaths;
+    std::unordered_map<juce::Identifier, std::unique_ptr<PropertyMirrorBase>, IdentifierHash>  propertyMirrors;
+    juce::CriticalSection                                                                      mirrorLock;
+    std::atomic<int> propertyTreeGeneration { 0 };
+    int              resolvedPathsGeneration = 0;
+
+    PropertyBridge propertyBridge { state };
+
+    SharedVisualiserWorkerPool visualiserPool;
+    bool                       visualisersIdleWithoutConsumers = false;
+
+    // declared last, the builders refer to the advertised objects
+    std::map<const MagicPlotSource*, std::unique_ptr<PlotPathBuilder>> plotPathBuilders;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicGUIState)
 };
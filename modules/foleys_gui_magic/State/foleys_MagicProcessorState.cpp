@@ -166,6 +166,9 @@ void MagicProcessorState::setStateInformation (const void* data, int sizeInBytes
 
     parameters.loadParameterValues (newState);
 
+    // don't let the audio thread read the old values until the AsyncUpdater kicks in
+    rebindProperties();
+
     if (editor)
     {
         int width, height;
@@ -189,23 +192,45 @@ void MagicProcessorState::updatePlayheadInformation (juce::AudioPlayHead* playhe
 
     if (const auto position = playhead->getPosition())
     {
+        auto& info = audioThreadPlayhead;
+
         if (auto seconds = position->getTimeInSeconds())
-            timeInSeconds.store (*seconds);
+            info.timeInSeconds = *seconds;
 
         if (auto currentBpm = position->getBpm())
-            bpm.store (*currentBpm);
+            info.bpm = *currentBpm;
 
         if (auto signature = position->getTimeSignature())
         {
-            timeSigNumerator.store (signature->numerator);
-            timeSigDenominator.store ((*signature).denominator);
+            info.timeSigNumerator   = signature->numerator;
+            info.timeSigDenominator = signature->denominator;
+        }
+
+        if (auto ppq = position->getPpqPosition())
+            info.ppqPosition = *ppq;
+
+        if (auto barStart = position->getPpqPositionOfLastBarStart())
+            info.ppqLastBarStart = *barStart;
+
+        if (auto loop = position->getLoopPoints())
+        {
+            info.ppqLoopStart = loop->ppqStart;
+            info.ppqLoopEnd   = loop->ppqEnd;
         }
 
-        isPlaying.store (position->getIsPlaying());
-        isRecording.store (position->getIsRecording());
+        info.isPlaying   = position->getIsPlaying();
+        info.isRecording = position->getIsRecording();
+        info.isLooping   = position->getIsLooping();
+
+        playheadInfo.store (info);
     }
 }
 
+MagicProcessorState::PlayheadInfo MagicProcessorState::getPlayheadInformation() const
+{
+    return playheadInfo.load();
+}
+
 void MagicProcessorState::setPlayheadUpdateFrequency (int frequency)
 {
     if (frequency > 0)
@@ -214,6 +239,30 @@ void MagicProcessorState::setPlayheadUpdateFrequency (int frequency)
         stopTimer();
 }
 
+void MagicProcessorState::setEditorCacheTimeout (int milliseconds)
+{
+    editorCache.timeout = std::max (0, milliseconds);
+
+    if (editorCache.timeout == 0)
+        editorCache.clear();
+}
+
+int MagicProcessorState::getEditorCacheTimeout() const
+{
+    return editorCache.timeout;
+}
+
+void MagicProcessorState::cacheGUIBuilder (std::unique_ptr<MagicGUIBuilder> builder)
+{
+    if (editorCache.timeout > 0)
+        editorCache.store (std::move (builder));
+}
+
+std::unique_ptr<MagicGUIBuilder> MagicProcessorState::takeCachedGUIBuilder()
+{
+    return editorCache.take();
+}
+
 void MagicProcessorState::processMidiBuffer (juce::MidiBuffer& buffer, int numSamples, bool injectIndirectEvents)
 {
     getKeyboardState().processNextMidiBuffer (buffer, 0, numSamples, injectIndirectEvents);
@@ -233,12 +282,79 @@ int MagicProcessorState::getLastController() const
 
 void MagicProcessorState::timerCallback()
 {
-    getPropertyAsValue ("playhead:bpm").setValue (bpm.load());
-    getPropertyAsValue ("playhead:timeInSeconds").setValue (timeInSeconds.load());
-    getPropertyAsValue ("playhead:timeSigNumerator").setValue (timeSigNumerator.load());
-    getPropertyAsValue ("playhead:timeSigDenominator").setValue (timeSigDenominator.load());
-    getPropertyAsValue ("playhead:isPlaying").setValue (isPlaying.load());
-    getPropertyAsValue ("playhead:isRecording").setValue (isRecording.load());
+    PlayheadInfo info;
+    if (! playheadInfo.tryLoad (info))
+        return;
+
+    // the state might have been replaced by setStateInformation, in that case resolve the node again
+    auto forceAll = false;
+    if (! playheadNode.isValid() || playheadNode.getParent().getParent() != getValueTree())
+    {
+        playheadNode = getPropertyRoot().getOrCreateChildWithName (IDs::playhead, nullptr);
+        forceAll = true;
+    }
+
+    publishPlayheadInformation (info, forceAll);
+}
+
+void MagicProcessorState::publishPlayheadInformation (const PlayheadInfo& info, bool forceAll)
+{
+    auto& last = lastPublishedPlayhead;
+
+    if (forceAll || info.bpm != last.bpm)
+        playheadNode.setProperty (IDs::bpm, info.bpm, nullptr);
+    if (forceAll || info.timeInSeconds != last.timeInSeconds)
+        playheadNode.setProperty (IDs::timeInSeconds, info.timeInSeconds, nullptr);
+    if (forceAll || info.ppqPosition != last.ppqPosition)
+        playheadNode.setProperty (IDs::ppqPosition, info.ppqPosition, nullptr);
+    if (forceAll || info.ppqLastBarStart != last.ppqLastBarStart)
+        playheadNode.setProperty (IDs::ppqLastBarStart, info.ppqLastBarStart, nullptr);
+    if (forceAll || info.ppqLoopStart != last.ppqLoopStart)
+        playheadNode.setProperty (IDs::ppqLoopStart, info.ppqLoopStart, nullptr);
+    if (forceAll || info.ppqLoopEnd != last.ppqLoopEnd)
+        playheadNode.setProperty (IDs::ppqLoopEnd, info.ppqLoopEnd, nullptr);
+    if (forceAll || info.timeSigNumerator != last.timeSigNumerator)
+        playheadNode.setProperty (IDs::timeSigNumerator, info.timeSigNumerator, nullptr);
+    if (forceAll || info.timeSigDenominator != last.timeSigDenominator)
+        playheadNode.setProperty (IDs::timeSigDenominator, info.timeSigDenominator, nullptr);
+    if (forceAll || info.isPlaying != last.isPlaying)
+        playheadNode.setProperty (IDs::isPlaying, info.isPlaying, nullptr);
+    if (forceAll || info.isRecording != last.isRecording)
+        playheadNode.setProperty (IDs::isRecording, info.isRecording, nullptr);
+    if (forceAll || info.isLooping != last.isLooping)
+        playheadNode.setProperty (IDs::isLooping, info.isLooping, nullptr);
+
+    last = info;
+}
+
+//==============================================================================
+
+MagicProcessorState::EditorCache::~EditorCache()
+{
+    stopTimer();
+}
+
+void MagicProcessorState::EditorCache::store (std::unique_ptr<MagicGUIBuilder> builderToKeep)
+{
+    builder = std::move (builderToKeep);
+    startTimer (timeout);
+}
+
+std::unique_ptr<MagicGUIBuilder> MagicProcessorState::EditorCache::take()
+{
+    stopTimer();
+    return std::move (builder);
+}
+
+void MagicProcessorState::EditorCache::clear()
+{
+    stopTimer();
+    builder.reset();
+}
+
+void MagicProcessorState::EditorCache::timerCallback()
+{
+    clear();
 }
 
 } // namespace foleys
@@ -35,10 +35,13 @@
 
 #include "foleys_ParameterManager.h"
 #include "foleys_MidiParameterMapper.h"
+#include "../Helpers/foleys_SeqLock.h"
 
 namespace foleys
 {
 
+class MagicGUIBuilder;
+
 /**
 The MagicProcessorState is a subclass of MagicGUIState, that adds AudioProcessor specific functionality.
  It allows for instance connecting to AudioProcessorParameters and supplies a default XML tree* of components
@@ -65,12 +68,35 @@ public:
      */
     juce::PopupMenu createParameterMenu() const override;
 
+    /**
+     A snapshot of the AudioPlayHead, as sent from the audio thread to the GUI
+     */
+    struct PlayheadInfo
+    {
+        double bpm                = 120.0;
+        double timeInSeconds      = 0.0;
+        double ppqPosition        = 0.0;
+        double ppqLastBarStart    = 0.0;
+        double ppqLoopStart       = 0.0;
+        double ppqLoopEnd         = 0.0;
+        int    timeSigNumerator   = 4;
+        int    timeSigDenominator = 4;
+        bool   isPlaying          = false;
+        bool   isRecording        = false;
+        bool   isLooping          = false;
+    };
+
     /**
      Calling this in the processBlock() will store the values from AudioPlayHead into the state, so it can be used in the GUI.
      To enable this call setPlayheadUpdateFrequency (frequency) with an appropriate value
      */
     void updatePlayheadInformation (juce::AudioPlayHead* playhead);
 
+    /**
+     Returns the last playhead information sent by updatePlayheadInformation. This is safe to call from any thread.
+     */
+    PlayheadInfo getPlayheadInformation() const;
+
     /**
      Starts the timer to fetch the playhead values from the audio thread
      */
@@ -82,6 +108,23 @@ public:
     void setLastEditorSize (int  width, int  height);
     bool getLastEditorSize (int& width, int& height);
 
+    /**
+     Keeps the GUI alive for that time after the editor was closed. When the editor is opened again
+     within that time, the existing components are attached instead of being created again.
+     A timeout of 0 (the default) switches the editor cache off.
+
+     @param milliseconds the time to keep the GUI after the editor was closed
+     */
+    void setEditorCacheTimeout (int milliseconds);
+    int  getEditorCacheTimeout() const;
+
+    /**
+     The MagicPluginEditor hands over its MagicGUIBuilder when it is closed,
+     MagicProcessor::createEditor takes it back if it is still there.
+     */
+    void cacheGUIBuilder (std::unique_ptr<MagicGUIBuilder> builder);
+    std::unique_ptr<MagicGUIBuilder> takeCachedGUIBuilder();
+
     /**
      This method will serialise the plugin state from AudioProcessorValueTreeState for
      the host to save in the session
@@ -143,17 +186,41 @@ private:
 
     void timerCallback() override;
 
+    void publishPlayheadInformation (const PlayheadInfo& info, bool forceAll);
+
     juce::AudioProcessor& processor;
 
     ParameterManager    parameters { processor };
     MidiParameterMapper midiMapper { *this };
 
-    std::atomic<double> bpm;
-    std::atomic<int>    timeSigNumerator;
-    std::atomic<int>    timeSigDenominator;
-    std::atomic<double> timeInSeconds;
-    std::atomic<bool>   isPlaying;
-    std::atomic<bool>   isRecording;
+    PlayheadInfo            audioThreadPlayhead;
+    SeqLock<PlayheadInfo>   playheadInfo;
+
+    juce::ValueTree         playheadNode;
+    PlayheadInfo            lastPublishedPlayhead;
+
+    class EditorCache : private juce::Timer
+    {
+    public:
+        EditorCache() = default;
+        ~EditorCache() override;
+
+        void store (std::unique_ptr<MagicGUIBuilder> builderToKeep);
+        std::unique_ptr<MagicGUIBuilder> take();
+        void clear();
+
+        int timeout = 0;
+
+    private:
+        void timerCallback() override;
+
+        std::unique_ptr<MagicGUIBuilder> builder;
+
+        JUCE_DECLARE_NON_COPYABLE (EditorCache)
+    };
+
+    // keep this last, the cached GUI is still connected to the members above
+    EditorCache             editorCache;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicProcessorState)
 };
@@ -0,0 +1,140 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_PropertyBridge.h"
+
+namespace foleys
+{
+
+PropertyBridge::PropertyBridge (juce::ValueTree& stateToFollow)
+  : state (stateToFollow)
+{
+    state.addListener (this);
+}
+
+PropertyBridge::~PropertyBridge()
+{
+    state.removeListener (this);
+}
+
+int PropertyBridge::addScalarBinding (const juce::Identifier& path, juce::ValueTree node, const juce::Identifier& property)
+{
+    const ScopedWriter writer (writing);
+
+    for (const auto& binding : scalarBindings)
+        if (binding.path == path)
+            return binding.index;
+
+    if (numSlots >= maxNumSlots)
+    {
+        // You bound more properties than the PropertyBridge has slots.
+        // Increase PropertyBridge::maxNumSlots
+        jassertfalse;
+        return -1;
+    }
+
+    const auto index = numSlots++;
+    slots [size_t (index)].store (static_cast<double> (node.getProperty (property)));
+
+    scalarsByProperty.insert ({ property, scalarBindings.size() });
+    scalarBindings.push_back ({ path, node, property, index });
+
+    return index;
+}
+
+void PropertyBridge::addStructBinding (const juce::Identifier& path, juce::ValueTree node, std::unique_ptr<StructSlotBase> slot)
+{
+    const ScopedWriter writer (writing);
+
+    slot->update (node);
+    structBindings.push_back ({ path, node, std::move (slot) });
+}
+
+void PropertyBridge::takeSnapshot (Snapshot& snapshot) const noexcept
+{
+    for (size_t i = 0; i < size_t (numSlots); ++i)
+        snapshot.values [i] = slots [i].load (std::memory_order_relaxed);
+}
+
+void PropertyBridge::rebind (const Resolver& resolver)
+{
+    const ScopedWriter writer (writing);
+
+    for (auto& binding : scalarBindings)
+    {
+        if (binding.node.isAChildOf (state))
+            continue;
+
+        binding.node = resolver (binding.path, false);
+        slots [size_t (binding.index)].store (static_cast<double> (binding.node.getProperty (binding.property)));
+    }
+
+    for (auto& binding : structBindings)
+    {
+        if (binding.node.isAChildOf (state))
+            continue;
+
+        binding.node = resolver (binding.path, true);
+        binding.slot->update (binding.node);
+    }
+}
+
+void PropertyBridge::publish (const Resolver& finder)
+{
+    const ScopedWriter writer (writing);
+
+    for (const auto& binding : scalarBindings)
+        slots [size_t (binding.index)].store (static_cast<double> (finder (binding.path, false).getProperty (binding.property)));
+
+    for (auto& binding : structBindings)
+        binding.slot->update (finder (binding.path, true));
+}
+
+void PropertyBridge::valueTreePropertyChanged (juce::ValueTree& tree, const juce::Identifier& property)
+{
+    const ScopedWriter writer (writing);
+
+    const auto range = scalarsByProperty.equal_range (property);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const auto& binding = scalarBindings [it->second];
+        if (binding.node == tree)
+            slots [size_t (binding.index)].store (static_cast<double> (tree.getProperty (property)), std::memory_order_relaxed);
+    }
+
+    for (auto& binding : structBindings)
+        if (binding.node == tree)
+            binding.slot->update (tree);
+}
+
+} // namespace foleys
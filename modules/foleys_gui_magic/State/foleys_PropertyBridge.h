@@ -0,0 +1,234 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_data_structures/juce_data_structures.h>
+
+#include "../Helpers/foleys_IdentifierHash.h"
+#include "../Helpers/foleys_SeqLock.h"
+
+namespace foleys
+{
+
+/**
+ The PropertyBridge mirrors properties of the MagicGUIState into a contiguous array of atomics,
+ so the audio thread can read many GUI properties in one cache friendly pass. Scalars like bool, int,
+ float and enums share the slot array, small structs are published via a SeqLock.
+
+ There is only one ValueTree::Listener for all bound properties. You don't create this class
+ yourself, use MagicGUIState::bindProperty() and MagicGUIState::bindPropertyNode() instead.
+ */
+class PropertyBridge : private juce::ValueTree::Listener
+{
+public:
+    static constexpr int maxNumSlots = 256;
+
+    /**
+     A handle to a scalar slot. It is a plain index, so it is cheap to copy into your audio code.
+     */
+    template<typename T>
+    struct Handle
+    {
+        int  index = -1;
+        bool isValid() const noexcept { return index >= 0; }
+    };
+
+    /**
+     A handle to a struct published via SeqLock.
+     */
+    template<typename T>
+    struct StructHandle
+    {
+        const SeqLock<T>* lock = nullptr;
+
+        bool isValid() const noexcept { return lock != nullptr; }
+        T    get() const noexcept     { return lock != nullptr ? lock->load() : T{}; }
+    };
+
+    /**
+     A Snapshot is a plain copy of all scalar slots. Keep one as member in your processor,
+     so taking a snapshot doesn't allocate.
+     */
+    struct Snapshot
+    {
+        template<typename T>
+        T get (Handle<T> handle) const noexcept
+        {
+            return handle.isValid() ? fromSlot<T> (values [size_t (handle.index)]) : T{};
+        }
+
+        std::array<double, maxNumSlots> values {};
+    };
+
+    /**
+     Looks up the node for a bound path, either the node of a property or the node itself
+     */
+    using Resolver = std::function<juce::ValueTree(const juce::Identifier& path, bool isNode)>;
+
+    PropertyBridge (juce::ValueTree& stateToFollow);
+    ~PropertyBridge() override;
+
+    /**
+     Bind a property to a scalar slot. Call this on the message thread.
+     */
+    template<typename T>
+    Handle<T> addBinding (const juce::Identifier& path, juce::ValueTree node, const juce::Identifier& property)
+    {
+        static_assert (std::is_arithmetic_v<T> || std::is_enum_v<T>, "Use addStructBinding for compound types");
+
+        const auto index = addScalarBinding (path, node, property);
+        return { index };
+    }
+
+    /**
+     Bind a whole node to a struct. The converter is called on the message thread each time
+     a property of that node changes, the result is published to the audio thread.
+     */
+    template<typename T>
+    StructHandle<T> addStructBinding (const juce::Identifier& path, juce::ValueTree node, std::function<T(const juce::ValueTree&)> converter)
+    {
+        auto slot = std::make_unique<StructSlot<T>>(std::move (converter));
+        auto* lock = &slot->lock;
+
+        addStructBinding (path, node, std::move (slot));
+        return { lock };
+    }
+
+    /**
+     Read a single scalar. This is safe to call from the audio thread.
+     */
+    template<typename T>
+    T get (Handle<T> handle) const noexcept
+    {
+        return handle.isValid() ? fromSlot<T> (slots [size_t (handle.index)].load (std::memory_order_relaxed)) : T{};
+    }
+
+    /**
+     Copy all scalar slots in one pass. This is safe to call from the audio thread.
+     */
+    void takeSnapshot (Snapshot& snapshot) const noexcept;
+
+    /**
+     After the property tree was restructured, this connects all bindings to the current nodes.
+     Call this on the message thread.
+     */
+    void rebind (const Resolver& resolver);
+
+    /**
+     Publishes the values of the nodes the finder returns, without following these nodes. This is used
+     by the thread restoring the state, the bindings are connected later by rebind on the message thread.
+     */
+    void publish (const Resolver& finder);
+
+private:
+    template<typename T>
+    static T fromSlot (double value) noexcept
+    {
+        if constexpr (std::is_same_v<T, bool>)
+            return value != 0.0;
+        else if constexpr (std::is_enum_v<T>)
+            return static_cast<T> (static_cast<int> (value));
+        else
+            return static_cast<T> (value);
+    }
+
+    struct StructSlotBase
+    {
+        virtual ~StructSlotBase() = default;
+        virtual void update (const juce::ValueTree& node) = 0;
+    };
+
+    template<typename T>
+    struct StructSlot : public StructSlotBase
+    {
+        StructSlot (std::function<T(const juce::ValueTree&)> converterToUse) : converter (std::move (converterToUse)) {}
+        // the SeqLock allows only one writer, the PropertyBridge makes sure of that with a ScopedWriter
+        void update (const juce::ValueTree& node) override { lock.store (converter (node)); }
+
+        std::function<T(const juce::ValueTree&)> converter;
+        SeqLock<T>                               lock;
+    };
+
+    struct ScalarBinding
+    {
+        juce::Identifier path;
+        juce::ValueTree  node;
+        juce::Identifier property;
+        int              index = -1;
+    };
+
+    struct StructBinding
+    {
+        juce::Identifier                path;
+        juce::ValueTree                 node;
+        std::unique_ptr<StructSlotBase> slot;
+    };
+
+    /**
+     The slots and SeqLocks are written from the message thread, and from the thread restoring the state.
+     The SeqLock allows only one writer, so the second writer spins until the first one is done.
+     */
+    struct ScopedWriter
+    {
+        ScopedWriter (std::atomic<bool>& flagToUse) : flag (flagToUse)
+        {
+            while (flag.exchange (true, std::memory_order_acquire))
+                juce::Thread::yield();
+        }
+
+        ~ScopedWriter() { flag.store (false, std::memory_order_release); }
+
+        std::atomic<bool>& flag;
+    };
+
+    int  addScalarBinding (const juce::Identifier& path, juce::ValueTree node, const juce::Identifier& property);
+    void addStructBinding (const juce::Identifier& path, juce::ValueTree node, std::unique_ptr<StructSlotBase> slot);
+
+    void valueTreePropertyChanged (juce::ValueTree& tree, const juce::Identifier& property) override;
+
+    juce::ValueTree& state;
+
+    alignas (64) std::array<std::atomic<double>, maxNumSlots> slots {};
+    int numSlots = 0;
+
+    std::atomic<bool> writing { false };
+
+    std::vector<ScalarBinding>                                        scalarBindings;
+    std::unordered_multimap<juce::Identifier, size_t, IdentifierHash> scalarsByProperty;
+    std::vector<StructBinding>                                        structBindings;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PropertyBridge)
+};
+
+} // namespace foleys
@@ -44,6 +44,9 @@ MagicAnalyser::MagicAnalyser (int channelToAnalyse)
 
 void MagicAnalyser::pushSamples (const juce::AudioBuffer<float>& buffer)
 {
+    if (! isProcessing())
+        return;
+
     analyserJob.pushSamples (buffer, channel);
 }
 
@@ -52,14 +55,16 @@ void MagicAnalyser::createPlotPaths (juce::Path& path, juce::Path& filledPath, j
     const float minFreq = 20.0f;
     const auto& data = analyserJob.getAnalyserData();
 
-    path.clear();
-    path.preallocateSpace (8 + data.getNumSamples() * 3);
-
+    // the geometry is shared by all callers, so it is written under the lock as well
     juce::ScopedLock lockedForReading (pathCreationLock);
+
+    geometry.clear();
+    geometry.reserve (size_t (data.getNumSamples()));
+
     const auto* fftData = data.getReadPointer (0);
     const auto  factor  = bounds.getWidth() / 10.0f;
 
-    path.startNewSubPath (bounds.getX() + factor * indexToX (0, minFreq), binToY (fftData [0], bounds));
+    geometry.addPoint (bounds.getX() + factor * indexToX (0, minFreq), binToY (fftData [0], bounds));
     for (int i = 1, step = 1, count = 0; i < data.getNumSamples(); i += step, ++count)
     {
         auto avg = fftData [i];
@@ -71,7 +76,7 @@ void MagicAnalyser::createPlotPaths (juce::Path& path, juce::Path& filledPath, j
             avg = avg / step;
         }
 
-        path.lineTo (bounds.getX() + factor * indexToX (i, minFreq), binToY (avg, bounds));
+        geometry.addPoint (bounds.getX() + factor * indexToX (i, minFreq), binToY (avg, bounds));
 
         if (count > 64)
         {
@@ -80,10 +85,7 @@ void MagicAnalyser::createPlotPaths (juce::Path& path, juce::Path& filledPath, j
         }
     }
 
-    filledPath = path;
-    filledPath.lineTo (bounds.getBottomRight());
-    filledPath.lineTo (bounds.getBottomLeft());
-    filledPath.closeSubPath();
+    geometry.createPaths (path, filledPath, bounds);
 }
 
 void MagicAnalyser::prepareToPlay (double sampleRateToUse, int)
@@ -154,12 +156,15 @@ void MagicAnalyser::AnalyserJob::pushSamples (const juce::AudioBuffer<float>& bu
         if (b.blockSize1 > 0) audioFifo.copyFrom (0, b.startIndex1, buffer.getReadPointer (inChannel), b.blockSize1);
         if (b.blockSize2 > 0) audioFifo.copyFrom (0, b.startIndex2, buffer.getReadPointer (inChannel, b.blockSize1), b.blockSize2);
     }
+
+    if (abstractFifo.getNumReady() >= fft.getSize())
+        workerPool->wakeUp (*this);
 }
 
 int MagicAnalyser::AnalyserJob::useTimeSlice()
 {
     if (abstractFifo.getNumReady() < fft.getSize())
-        return 10;
+        return VisualiserWorkerPool::parkUntilWokenUp;
 
     {
         fftBuffer.clear();
@@ -199,7 +204,7 @@ int MagicAnalyser::AnalyserJob::useTimeSlice()
     return 1;
 }
 
-const juce::AudioBuffer<float> MagicAnalyser::AnalyserJob::getAnalyserData() const
+const juce::AudioBuffer<float>& MagicAnalyser::AnalyserJob::getAnalyserData() const
 {
     return values;
 }
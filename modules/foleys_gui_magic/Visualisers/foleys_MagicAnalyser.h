@@ -34,6 +34,7 @@
 #pragma once
 
 #include "foleys_MagicPlotSource.h"
+#include "foleys_VisualiserWorkerPool.h"
 
 namespace foleys
 {
@@ -78,7 +79,7 @@ public:
 
     /**
      If your plot needs background processing, return here a pointer to your TimeSliceClient,
-     and it will automatically be added to the common background thread.
+     and it will automatically be added to the shared VisualiserWorkerPool.
      */
     juce::TimeSliceClient* getBackgroundJob() override;
 
@@ -87,7 +88,7 @@ private:
     float indexToX (int index, float minFreq) const;
     float binToY (float bin, juce::Rectangle<float> bounds) const;
 
-    class AnalyserJob : public juce::TimeSliceClient
+    class AnalyserJob : public VisualiserWorkerPool::WakeableJob
     {
     public:
         AnalyserJob (MagicAnalyser& owner);
@@ -97,13 +98,15 @@ private:
 
         void setupAnalyser (int audioFifoSize);
 
-        const juce::AudioBuffer<float> getAnalyserData() const;
+        const juce::AudioBuffer<float>& getAnalyserData() const;
 
         juce::dsp::FFT fft                            { 12 };
 
     private:
         MagicAnalyser& owner;
 
+        SharedVisualiserWorkerPool workerPool;
+
         juce::AbstractFifo abstractFifo               { 48000 };
         juce::AudioBuffer<float> audioFifo;
 
@@ -120,6 +123,7 @@ private:
     int               channel = -1;
 
     juce::CriticalSection pathCreationLock;
+    PlotGeometry          geometry;
     AnalyserJob analyserJob { *this };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicAnalyser)
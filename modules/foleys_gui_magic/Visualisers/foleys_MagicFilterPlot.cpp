@@ -40,77 +40,208 @@ namespace foleys
 
 MagicFilterPlot::MagicFilterPlot()
 {
-    frequencies.resize (300);
-    for (size_t i = 0; i < frequencies.size(); ++i)
-        frequencies [i] = 20.0 * std::pow (2.0, i / 30.0);
+    updateFrequencyGrid();
+}
+
+void MagicFilterPlot::setFrequencyGrid (double minFrequencyToUse, double maxFrequencyToUse, int numPointsToUse)
+{
+    // the grid is logarithmic, so the frequencies need to be positive
+    jassert (minFrequencyToUse > 0.0 && maxFrequencyToUse > minFrequencyToUse && numPointsToUse > 1);
+
+    if (minFrequencyToUse <= 0.0 || maxFrequencyToUse <= minFrequencyToUse)
+        return;
+
+    minFrequency = minFrequencyToUse;
+    maxFrequency = maxFrequencyToUse;
 
-    magnitudes.resize (frequencies.size());
+    // the grid spacing divides by numPoints - 1
+    numPoints    = std::max (numPointsToUse, 2);
+
+    updateFrequencyGrid();
 }
 
-void MagicFilterPlot::setIIRCoefficients (juce::dsp::IIR::Coefficients<float>::Ptr coefficients, float maxDBToDisplay)
+void MagicFilterPlot::updateFrequencyGrid()
 {
-    if (sampleRate < 20.0)
+    const juce::ScopedLock calculationGuard (calculationLock);
+
+    const auto size = size_t (numPoints);
+
+    frequencies.resize (size);
+    for (size_t i = 0; i < size; ++i)
+        frequencies [i] = minFrequency * std::pow (maxFrequency / minFrequency, double (i) / double (size - 1));
+
+    cos1.resize (size);
+    sin1.resize (size);
+    cos2.resize (size);
+    sin2.resize (size);
+
+    if (sampleRate > 0.0)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto w = juce::MathConstants<double>::twoPi * frequencies [i] / sampleRate;
+            cos1 [i] = std::cos (w);
+            sin1 [i] = std::sin (w);
+            cos2 [i] = std::cos (2.0 * w);
+            sin2 [i] = std::sin (2.0 * w);
+        }
+    }
+
+    magnitudes.resize (size);
+    nextLevels.resize (size);
+
+    {
+        const juce::ScopedWriteLock writeLock (plotLock);
+        levels.assign (size, std::numeric_limits<float>::lowest());
+    }
+
+    // the stored coefficients are evaluated at the new frequencies, so the curve doesn't vanish
+    for (auto& response : bandResponses)
+        response.magnitudes.clear();
+
+    if (sampleRate >= 20.0 && ! bandResponses.empty())
+    {
+        updateMagnitudes();
+        publishMagnitudes (maxDB);
+    }
+}
+
+void MagicFilterPlot::computeMagnitudes (const juce::dsp::IIR::Coefficients<float>& coefficients, double* output) const
+{
+    const auto& c = coefficients.coefficients;
+    const auto  order = (c.size() - 1) / 2;
+
+    if (order > 2)
+    {
+        coefficients.getMagnitudeForFrequencyArray (frequencies.data(), output, frequencies.size(), sampleRate);
         return;
+    }
+
+    // juce stores normalised coefficients: b0, b1, [b2,] a1, [a2]
+    const double b0 = c [0];
+    const double b1 = c [1];
+    const double b2 = order == 2 ? c [2] : 0.0;
+    const double a1 = order == 2 ? c [3] : c [2];
+    const double a2 = order == 2 ? c [4] : 0.0;
+
+    const auto size = frequencies.size();
+    const auto* c1 = cos1.data();
+    const auto* s1 = sin1.data();
+    const auto* c2 = cos2.data();
+    const auto* s2 = sin2.data();
+
+    // no branches, so the compiler can vectorise this loop
+    for (size_t i = 0; i < size; ++i)
+    {
+        const auto nr = b0 + b1 * c1 [i] + b2 * c2 [i];
+        const auto ni = b1 * s1 [i] + b2 * s2 [i];
+        const auto dr = 1.0 + a1 * c1 [i] + a2 * c2 [i];
+        const auto di = a1 * s1 [i] + a2 * s2 [i];
+
+        output [i] = std::sqrt ((nr * nr + ni * ni) / (dr * dr + di * di));
+    }
+}
 
-    const juce::ScopedWriteLock writeLock (plotLock);
+void MagicFilterPlot::publishMagnitudes (float maxDBToDisplay)
+{
+    for (size_t i = 0; i < magnitudes.size(); ++i)
+        nextLevels [i] = magnitudes [i] > 0.0 ? float (std::log2 (magnitudes [i])) : std::numeric_limits<float>::lowest();
 
-    maxDB = maxDBToDisplay;
-    coefficients->getMagnitudeForFrequencyArray (frequencies.data(),
-                                                 magnitudes.data(),
-                                                 frequencies.size(),
-                                                 sampleRate);
+    {
+        const juce::ScopedWriteLock writeLock (plotLock);
+        maxDB = maxDBToDisplay;
+        std::swap (levels, nextLevels);
+    }
 
     resetLastDataFlag();
 }
 
-void MagicFilterPlot::setIIRCoefficients (float gain, std::vector<juce::dsp::IIR::Coefficients<float>::Ptr> coefficients, float maxDBToDisplay)
+void MagicFilterPlot::setIIRCoefficients (juce::dsp::IIR::Coefficients<float>::Ptr coefficients, float maxDBToDisplay)
 {
-    if (sampleRate < 20.0)
+    if (coefficients == nullptr)
         return;
 
-    const juce::ScopedWriteLock writeLock (plotLock);
+    setIIRCoefficients (1.0f, { coefficients }, maxDBToDisplay);
+}
 
-    std::vector<double> buffer (frequencies.size(), 0.0);
+void MagicFilterPlot::setIIRCoefficients (float gain, std::vector<juce::dsp::IIR::Coefficients<float>::Ptr> coefficients, float maxDBToDisplay)
+{
+    const juce::ScopedLock calculationGuard (calculationLock);
 
-    maxDB = maxDBToDisplay;
-    std::fill (magnitudes.begin(), magnitudes.end(), gain);
+    bandGain = gain;
+    bandResponses.resize (coefficients.size());
 
-    for (auto ptr : coefficients)
+    for (size_t band = 0; band < coefficients.size(); ++band)
     {
-        ptr->getMagnitudeForFrequencyArray (frequencies.data(),
-                                            buffer.data(),
-                                            frequencies.size(),
-                                            sampleRate);
-        juce::FloatVectorOperations::multiply (magnitudes.data(), buffer.data(), int (magnitudes.size()));
+        auto& response = bandResponses [band];
+
+        if (coefficients [band] == nullptr)
+        {
+            response = {};
+        }
+        else if (response.coefficients == nullptr || response.coefficients->coefficients != coefficients [band]->coefficients)
+        {
+            // a copy, so the response can be evaluated again when the frequency grid changes
+            response.coefficients = new juce::dsp::IIR::Coefficients<float> (*coefficients [band]);
+            response.magnitudes.clear();
+        }
     }
 
-    resetLastDataFlag();
+    if (sampleRate < 20.0)
+        return;
+
+    updateMagnitudes();
+    publishMagnitudes (maxDBToDisplay);
+}
+
+void MagicFilterPlot::updateMagnitudes()
+{
+    std::fill (magnitudes.begin(), magnitudes.end(), double (bandGain));
+
+    for (auto& response : bandResponses)
+    {
+        if (response.coefficients == nullptr)
+            continue;
+
+        // only bands with changed coefficients or a changed grid are evaluated again
+        if (response.magnitudes.size() != magnitudes.size())
+        {
+            response.magnitudes.resize (magnitudes.size());
+            computeMagnitudes (*response.coefficients, response.magnitudes.data());
+        }
+
+        juce::FloatVectorOperations::multiply (magnitudes.data(), response.magnitudes.data(), int (magnitudes.size()));
+    }
 }
 
 void MagicFilterPlot::pushSamples (const juce::AudioBuffer<float>&){}
 
 void MagicFilterPlot::createPlotPaths (juce::Path& path, juce::Path& filledPath, juce::Rectangle<float> bounds, MagicPlotComponent&)
 {
+    // several components can create paths at the same time, the geometry is written exclusively
+    const juce::ScopedLock geometryGuard (geometryLock);
     const juce::ScopedReadLock readLock (plotLock);
 
     const auto yFactor = 2.0f * bounds.getHeight() / juce::Decibels::decibelsToGain (maxDB);
-    const auto xFactor = static_cast<double> (bounds.getWidth()) / frequencies.size();
-
-    path.clear();
-    path.startNewSubPath (bounds.getX(), float (magnitudes [0] > 0 ? bounds.getCentreY() - yFactor * std::log (magnitudes [0]) / std::log (2) : bounds.getBottom()));
-    for (size_t i=1; i < frequencies.size(); ++i)
-        path.lineTo (float (bounds.getX() + i * xFactor),
-                     float (magnitudes [i] > 0 ? bounds.getCentreY() - yFactor * std::log (magnitudes [i]) / std::log (2) : bounds.getBottom()));
-
-    filledPath = path;
-    filledPath.lineTo (bounds.getBottomRight());
-    filledPath.lineTo (bounds.getBottomLeft());
-    filledPath.closeSubPath();
+    const auto xFactor = bounds.getWidth() / float (levels.size());
+
+    geometry.clear();
+    geometry.reserve (levels.size());
+
+    for (size_t i=0; i < levels.size(); ++i)
+        geometry.addPoint (bounds.getX() + float (i) * xFactor,
+                           levels [i] > std::numeric_limits<float>::lowest() ? bounds.getCentreY() - yFactor * levels [i] : bounds.getBottom());
+
+    geometry.createPaths (path, filledPath, bounds);
 }
 
 void MagicFilterPlot::prepareToPlay (double sampleRateToUse, int)
 {
+    if (sampleRateToUse == sampleRate)
+        return;
+
     sampleRate = sampleRateToUse;
+    updateFrequencyGrid();
 }
 
 } // namespace foleys
@@ -66,6 +66,16 @@ public:
      */
     void setIIRCoefficients (float gain, std::vector<juce::dsp::IIR::Coefficients<float>::Ptr> coefficients, float maxDB);
 
+    /**
+     Set the frequencies the response is evaluated at. They are spaced logarithmically.
+     The last coefficients are evaluated again at the new frequencies.
+
+     @param minFrequency the lowest frequency of the plot
+     @param maxFrequency the highest frequency of the plot
+     @param numPoints the resolution of the plot
+     */
+    void setFrequencyGrid (double minFrequency, double maxFrequency, int numPoints);
+
     /**
      Does nothing in this class
      */
@@ -84,13 +94,42 @@ public:
     void prepareToPlay (double sampleRate, int samplesPerBlockExpected) override;
 
 private:
+    struct BandResponse
+    {
+        juce::dsp::IIR::Coefficients<float>::Ptr coefficients;
+        std::vector<double>                      magnitudes;
+    };
+
+    void updateFrequencyGrid();
+    void updateMagnitudes();
+    void computeMagnitudes (const juce::dsp::IIR::Coefficients<float>& coefficients, double* output) const;
+    void publishMagnitudes (float maxDB);
+
+    // the plotLock is only held to swap the finished curve, so painting doesn't wait for the calculation
     juce::ReadWriteLock     plotLock;
+    juce::CriticalSection   calculationLock;
 
+    double                  minFrequency = 20.0;
+    double                  maxFrequency = 20000.0;
+    int                     numPoints    = 300;
+
+    // e^-jw and e^-2jw for each frequency, so evaluating a biquad needs no trigonometry
     std::vector<double>     frequencies;
-    std::vector<double>     magnitudes;
+    std::vector<double>     cos1, sin1, cos2, sin2;
+
+    std::vector<double>       magnitudes;
+    std::vector<BandResponse> bandResponses;
+    float                     bandGain = 1.0f;
+
+    // the curve as log2 of the magnitudes, ready to be drawn
+    std::vector<float>      levels;
+    std::vector<float>      nextLevels;
     float                   maxDB      = 100.0f;
     double                  sampleRate = 0.0;
 
+    juce::CriticalSection   geometryLock;
+    PlotGeometry            geometry;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicFilterPlot)
 };
 
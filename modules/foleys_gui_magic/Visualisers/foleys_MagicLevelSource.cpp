@@ -38,6 +38,9 @@ namespace foleys
 
 void MagicLevelSource::pushSamples (const juce::AudioBuffer<float>& buffer)
 {
+    if (! isProcessing())
+        return;
+
     for (int c=0; c < std::min (buffer.getNumChannels(), int (channelDatas.size())); ++c)
     {
         auto& data = channelDatas [size_t (c)];
@@ -67,6 +67,25 @@ public:
     void setNumChannels (int numChannels);
     int getNumChannels() const;
 
+    /**
+     Meters displaying this source register themselves as consumers. If you read the source
+     in your own component, register it as well. Call these on the message thread.
+     */
+    void addConsumer()      { ++numConsumers; }
+    void removeConsumer()   { jassert (numConsumers.load() > 0); --numConsumers; }
+    bool hasConsumers() const noexcept { return numConsumers.load (std::memory_order_relaxed) > 0; }
+
+    /**
+     If enabled, pushSamples() returns immediately while no consumer is registered. This is off
+     by default, because readers that don't call addConsumer() would get no data.
+     */
+    void setIdleWithoutConsumers (bool shouldIdle) { idleWithoutConsumers.store (shouldIdle); }
+
+    bool isProcessing() const noexcept
+    {
+        return ! idleWithoutConsumers.load (std::memory_order_relaxed) || hasConsumers();
+    }
+
     //==============================================================================
 
 private:
@@ -84,6 +103,8 @@ private:
 
     std::vector<ChannelData> channelDatas;
     int                      maxCountdown = 22050;
+    std::atomic<int>         numConsumers { 0 };
+    std::atomic<bool>        idleWithoutConsumers { false };
 
     JUCE_DECLARE_WEAK_REFERENCEABLE (MagicLevelSource)
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicLevelSource)
@@ -44,6 +44,9 @@ MagicOscilloscope::MagicOscilloscope (int channelToDisplay)
 
 void MagicOscilloscope::pushSamples (const juce::AudioBuffer<float>& buffer)
 {
+    if (! isProcessing())
+        return;
+
     auto w = writePosition.load();
     const auto numSamples = buffer.getNumSamples();
     const auto available  = samples.getNumSamples() - w;
@@ -123,9 +126,13 @@ void MagicOscilloscope::createPlotPaths (juce::Path& path, juce::Path& filledPat
         sign = data [pos] > 0.0f;
     }
 
-    path.clear();
-    path.startNewSubPath (bounds.getX(),
-                          juce::jmap (data [pos], -1.0f, 1.0f, bounds.getBottom(), bounds.getY()));
+    // several components can create paths at the same time, the geometry is written exclusively
+    const juce::ScopedLock geometryGuard (geometryLock);
+
+    geometry.clear();
+    geometry.reserve (size_t (numToDisplay));
+    geometry.addPoint (bounds.getX(),
+                       juce::jmap (data [pos], -1.0f, 1.0f, bounds.getBottom(), bounds.getY()));
 
     for (int i = 1; i < numToDisplay; ++i)
     {
@@ -133,14 +140,11 @@ void MagicOscilloscope::createPlotPaths (juce::Path& path, juce::Path& filledPat
         if (pos >= samples.getNumSamples())
             pos -= samples.getNumSamples();
 
-        path.lineTo (juce::jmap (float (i),   0.0f, float (numToDisplay), bounds.getX(), bounds.getRight()),
-                     juce::jmap (data [pos], -1.0f, 1.0f,                 bounds.getBottom(), bounds.getY()));
+        geometry.addPoint (juce::jmap (float (i),   0.0f, float (numToDisplay), bounds.getX(), bounds.getRight()),
+                           juce::jmap (data [pos], -1.0f, 1.0f,                 bounds.getBottom(), bounds.getY()));
     }
 
-    filledPath = path;
-    filledPath.lineTo (bounds.getBottomRight());
-    filledPath.lineTo (bounds.getBottomLeft());
-    filledPath.closeSubPath();
+    geometry.createPaths (path, filledPath, bounds);
 }
 
 void MagicOscilloscope::prepareToPlay (double sampleRateToUse, int)
@@ -77,6 +77,9 @@ private:
     juce::AudioBuffer<float> samples;
     std::atomic<int>         writePosition;
 
+    juce::CriticalSection    geometryLock;
+    PlotGeometry             geometry;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicOscilloscope)
 };
 
@@ -36,6 +36,8 @@
 #include <juce_graphics/juce_graphics.h>
 #include <juce_audio_basics/juce_audio_basics.h>
 
+#include "foleys_PlotGeometry.h"
+
 namespace foleys
 {
 
@@ -59,7 +61,10 @@ public:
     virtual void pushSamples (const juce::AudioBuffer<float>& buffer)=0;
 
     /**
-     This is the callback that creates the plot for drawing.
+     This is the callback that creates the plot for drawing. The paths are reused for each call,
+     to avoid allocations write the points into a PlotGeometry and use PlotGeometry::createPaths.
+     Several components can call this at the same time, also from the VisualiserWorkerPool,
+     so a PlotGeometry member must only be written while holding a lock.
 
      @param path is the path instance that is constructed by the MagicPlotSource
      @param filledPath is the path instance that is constructed by the MagicPlotSource to be filled
@@ -91,12 +96,67 @@ public:
 
     /**
      If your plot needs background processing, return here a pointer to your TimeSliceClient,
-     and it will automatically be added to the common background thread.
+     and it will automatically be added to the shared VisualiserWorkerPool.
      */
     virtual juce::TimeSliceClient* getBackgroundJob() { return nullptr; }
 
+    /**
+     Components displaying this source register themselves as consumers. If you read the source
+     in your own component, register it as well. Call these on the message thread.
+     */
+    void addConsumer()
+    {
+        const auto wasProcessing = isProcessing();
+        ++numConsumers;
+        processingMaybeChanged (wasProcessing);
+    }
+
+    void removeConsumer()
+    {
+        jassert (numConsumers.load() > 0);
+
+        const auto wasProcessing = isProcessing();
+        --numConsumers;
+        processingMaybeChanged (wasProcessing);
+    }
+
+    bool hasConsumers() const noexcept { return numConsumers.load (std::memory_order_relaxed) > 0; }
+
+    /**
+     If enabled, pushSamples() returns immediately and the background job is suspended while no
+     consumer is registered. This is off by default, because readers that don't call addConsumer()
+     would get no data. Call this on the message thread.
+     */
+    void setIdleWithoutConsumers (bool shouldIdle)
+    {
+        const auto wasProcessing = isProcessing();
+        idleWithoutConsumers.store (shouldIdle);
+        processingMaybeChanged (wasProcessing);
+    }
+
+    /**
+     This is a single atomic read, so it is safe to be called in pushSamples
+     */
+    bool isProcessing() const noexcept
+    {
+        return ! idleWithoutConsumers.load (std::memory_order_relaxed) || hasConsumers();
+    }
+
+    /**
+     This is called on the message thread when the source starts or stops processing.
+     */
+    std::function<void(bool isProcessing)> onProcessingChanged;
+
 private:
+    void processingMaybeChanged (bool wasProcessing)
+    {
+        if (wasProcessing != isProcessing() && onProcessingChanged)
+            onProcessingChanged (isProcessing());
+    }
+
     std::atomic<juce::int64> lastData { 0 };
+    std::atomic<int>         numConsumers { 0 };
+    std::atomic<bool>        idleWithoutConsumers { false };
     bool active = true;
 
     JUCE_DECLARE_WEAK_REFERENCEABLE (MagicPlotSource)
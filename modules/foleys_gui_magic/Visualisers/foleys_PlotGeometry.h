@@ -0,0 +1,104 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+
+namespace foleys
+{
+
+/**
+ The PlotGeometry is a reusable buffer for the points of a plot. A MagicPlotSource writes the points
+ once, and both the stroke and the fill path are written from them in a single pass. A juce::Path
+ can't share its storage with another one, so each path keeps its own. Clearing keeps the allocated
+ memory, and so do the juce::Paths, so in the steady state creating the plot doesn't allocate.
+
+ The geometry isn't thread safe, a source that is used by several components must guard it.
+ */
+class PlotGeometry
+{
+public:
+    PlotGeometry() = default;
+
+    /**
+     Removes all points, but keeps the storage.
+     */
+    void clear() noexcept { points.clear(); }
+
+    void reserve (size_t numPoints) { points.reserve (numPoints); }
+
+    void addPoint (float x, float y) { points.push_back ({ x, y }); }
+
+    bool isEmpty() const noexcept { return points.empty(); }
+
+    const std::vector<juce::Point<float>>& getPoints() const noexcept { return points; }
+
+    /**
+     Writes the points into the stroke path, and into the fill path, which is closed along the
+     bottom of the bounds. Both paths are cleared first, but keep their storage.
+     */
+    void createPaths (juce::Path& stroke, juce::Path& fill, juce::Rectangle<float> bounds) const
+    {
+        stroke.clear();
+        fill.clear();
+
+        if (points.empty())
+            return;
+
+        // startNewSubPath and lineTo use three floats each, closeSubPath one
+        const auto numCoords = int (points.size()) * 3;
+        stroke.preallocateSpace (numCoords);
+        fill.preallocateSpace (numCoords + 7);
+
+        stroke.startNewSubPath (points.front());
+        fill.startNewSubPath (points.front());
+
+        for (size_t i = 1; i < points.size(); ++i)
+        {
+            stroke.lineTo (points [i]);
+            fill.lineTo (points [i]);
+        }
+
+        fill.lineTo (bounds.getBottomRight());
+        fill.lineTo (bounds.getBottomLeft());
+        fill.closeSubPath();
+    }
+
+private:
+    std::vector<juce::Point<float>> points;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PlotGeometry)
+};
+
+} // namespace foleys
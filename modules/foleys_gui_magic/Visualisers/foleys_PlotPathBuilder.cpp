@@ -0,0 +1,147 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_PlotPathBuilder.h"
+#include "foleys_MagicPlotSource.h"
+
+namespace foleys
+{
+
+PlotPathBuilder::PlotPathBuilder (MagicPlotSource& sourceToUse, const void* owner)
+  : source (sourceToUse)
+{
+    workerPool->addJob (this, owner);
+}
+
+PlotPathBuilder::~PlotPathBuilder()
+{
+    // all targets must be destroyed before the builder
+    jassert (targets.empty());
+
+    // waits for a build in progress
+    workerPool->removeJob (this);
+}
+
+std::unique_ptr<PlotPathBuilder::Target> PlotPathBuilder::createTarget (MagicPlotComponent& component)
+{
+    std::unique_ptr<Target> target (new Target (*this, component));
+
+    const juce::ScopedLock sl (targetsLock);
+    targets.push_back (target.get());
+
+    return target;
+}
+
+void PlotPathBuilder::removeTarget (Target* target)
+{
+    const juce::ScopedLock sl (targetsLock);
+    targets.erase (std::remove (targets.begin(), targets.end(), target), targets.end());
+}
+
+int PlotPathBuilder::useTimeSlice()
+{
+    const juce::ScopedLock sl (targetsLock);
+    const auto lastData = source.getLastDataUpdate();
+
+    for (auto* target : targets)
+        target->build (lastData);
+
+    return VisualiserWorkerPool::parkUntilWokenUp;
+}
+
+//==============================================================================
+
+PlotPathBuilder::Target::Target (PlotPathBuilder& builderToUse, MagicPlotComponent& componentToUse)
+  : builder (builderToUse),
+    component (componentToUse)
+{
+}
+
+PlotPathBuilder::Target::~Target()
+{
+    builder.removeTarget (this);
+}
+
+void PlotPathBuilder::Target::setSize (juce::Rectangle<float> bounds)
+{
+    const auto previousWidth  = targetWidth.exchange (bounds.getWidth());
+    const auto previousHeight = targetHeight.exchange (bounds.getHeight());
+
+    if (previousWidth != bounds.getWidth() || previousHeight != bounds.getHeight())
+        builder.workerPool->wakeUp (builder);
+}
+
+PlotPathBuilder::Paths::Ptr PlotPathBuilder::Target::getPaths()
+{
+    consumed.store (true);
+
+    const juce::SpinLock::ScopedLockType swap (swapLock);
+    return front;
+}
+
+void PlotPathBuilder::Target::checkForNewData()
+{
+    if (consumed.load() && builder.source.getLastDataUpdate() > builtTimestamp.load())
+        builder.workerPool->wakeUp (builder);
+}
+
+void PlotPathBuilder::Target::build (juce::int64 lastData)
+{
+    const juce::Rectangle<float> bounds (targetWidth.load(), targetHeight.load());
+
+    if (bounds.isEmpty())
+        return;
+
+    if (bounds == builtBounds && (lastData <= builtTimestamp.load() || ! consumed.load()))
+        return;
+
+    // the spare is still held by a paint call, if anybody but the spare and this holds it
+    auto back = spare;
+    if (back == nullptr || back->getReferenceCount() > 2)
+        back = new Paths();
+
+    builder.source.createPlotPaths (back->path, back->filledPath, bounds, component);
+
+    {
+        const juce::SpinLock::ScopedLockType swap (swapLock);
+        std::swap (front, back);
+    }
+
+    spare = back;
+    consumed.store (false);
+    builtTimestamp.store (lastData);
+    builtBounds = bounds;
+    ++generation;
+}
+
+} // namespace foleys
@@ -0,0 +1,158 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+
+#include "foleys_VisualiserWorkerPool.h"
+
+namespace foleys
+{
+
+class MagicPlotSource;
+class MagicPlotComponent;
+
+/**
+ The PlotPathBuilder creates the paths of a MagicPlotSource on the VisualiserWorkerPool instead of
+ in the paint call. There is one builder per source, each MagicGUIState creates them on demand. Every
+ MagicPlotComponent that has plot-background-paths set gets a Target from it, which receives the
+ paths in the size the component reported last. The builder creates the paths of all targets one
+ after another, so createPlotPaths is never called concurrently by the builder. The
+ createPlotPaths implementation must not access the component, since it is called on the worker.
+
+ Painting never waits for the worker: the size is handed over in atomics, and the paths are built
+ into a spare buffer that is swapped with the published one. A buffer is only reused for building
+ when no paint call holds it anymore. The builder is parked until a target reports a new size or
+ new data of the source.
+ */
+class PlotPathBuilder : public VisualiserWorkerPool::WakeableJob
+{
+public:
+    struct Paths : public juce::ReferenceCountedObject
+    {
+        using Ptr = juce::ReferenceCountedObjectPtr<Paths>;
+
+        juce::Path path;
+        juce::Path filledPath;
+    };
+
+    /**
+     The Target receives the paths for one component.
+     */
+    class Target
+    {
+    public:
+        ~Target();
+
+        /**
+         The component reports the size it draws the plot in. This doesn't lock, so it can be called from paint.
+         */
+        void setSize (juce::Rectangle<float> bounds);
+
+        /**
+         Returns the most recent paths, or nullptr if none were built yet. They are not reused
+         for building while the returned pointer is held.
+         */
+        Paths::Ptr getPaths();
+
+        /**
+         This is incremented each time new paths are available.
+         */
+        int getGeneration() const noexcept { return generation.load(); }
+
+        /**
+         Wakes the builder, if the source has newer data than the paths that were painted last.
+         The component calls this once per frame on the message thread.
+         */
+        void checkForNewData();
+
+    private:
+        friend class PlotPathBuilder;
+        Target (PlotPathBuilder& builder, MagicPlotComponent& component);
+
+        // called on the worker with the targetsLock held
+        void build (juce::int64 lastData);
+
+        PlotPathBuilder&    builder;
+        MagicPlotComponent& component;
+
+        std::atomic<int>         generation { 0 };
+        std::atomic<float>       targetWidth  { 0.0f };
+        std::atomic<float>       targetHeight { 0.0f };
+        std::atomic<juce::int64> builtTimestamp { 0 };
+
+        // set when the paths were painted, so sources aren't built again for hidden components
+        std::atomic<bool>        consumed { true };
+
+        // only accessed by the worker
+        juce::Rectangle<float> builtBounds;
+        Paths::Ptr             spare;
+
+        // only held to exchange the pointer
+        juce::SpinLock         swapLock;
+        Paths::Ptr             front;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Target)
+    };
+
+    /**
+     Creates a builder for a source. The owner is used to prefer visible editors in the VisualiserWorkerPool.
+     */
+    PlotPathBuilder (MagicPlotSource& source, const void* owner);
+    ~PlotPathBuilder() override;
+
+    /**
+     Creates a Target for a component. It must be destroyed before the builder.
+     */
+    std::unique_ptr<Target> createTarget (MagicPlotComponent& component);
+
+    MagicPlotSource& getSource() const noexcept { return source; }
+
+    int useTimeSlice() override;
+
+private:
+    void removeTarget (Target* target);
+
+    MagicPlotSource& source;
+
+    SharedVisualiserWorkerPool workerPool;
+
+    // held while building, so removing a target waits for a build in progress
+    juce::CriticalSection targetsLock;
+    std::vector<Target*>  targets;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PlotPathBuilder)
+};
+
+} // namespace foleys
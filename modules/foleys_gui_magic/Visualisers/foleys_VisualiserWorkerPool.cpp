@@ -0,0 +1,229 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_VisualiserWorkerPool.h"
+
+namespace foleys
+{
+
+VisualiserWorkerPool::VisualiserWorkerPool()
+  : numThreads (juce::jlimit (1, 4, juce::SystemStats::getNumPhysicalCpus() - 1))
+{
+}
+
+VisualiserWorkerPool::~VisualiserWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> guard (lock);
+        shouldExit = true;
+    }
+
+    condition.notify_all();
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+void VisualiserWorkerPool::addJob (juce::TimeSliceClient* job, const void* owner)
+{
+    {
+        std::lock_guard<std::mutex> guard (lock);
+
+        for (const auto& existing : jobs)
+            if (existing.client == job)
+                return;
+
+        jobs.push_back ({ job, dynamic_cast<WakeableJob*> (job), owner, Clock::now() });
+
+        // threads are started lazily, so a process without visualisers doesn't have any
+        while (int (threads.size()) < numThreads)
+            threads.emplace_back ([this] { runWorker(); });
+    }
+
+    condition.notify_one();
+}
+
+void VisualiserWorkerPool::removeJob (juce::TimeSliceClient* job)
+{
+    std::unique_lock<std::mutex> guard (lock);
+    waitUntilNotRunning (guard, job);
+
+    jobs.erase (std::remove_if (jobs.begin(), jobs.end(), [job](const auto& j) { return j.client == job; }), jobs.end());
+}
+
+void VisualiserWorkerPool::removeJobsOf (const void* owner)
+{
+    std::unique_lock<std::mutex> guard (lock);
+
+    for (;;)
+    {
+        auto running = std::find_if (jobs.begin(), jobs.end(), [owner](const auto& j) { return j.owner == owner && j.running; });
+        if (running == jobs.end())
+            break;
+
+        waitUntilNotRunning (guard, running->client);
+    }
+
+    jobs.erase (std::remove_if (jobs.begin(), jobs.end(), [owner](const auto& j) { return j.owner == owner; }), jobs.end());
+    visibleOwners.erase (std::remove (visibleOwners.begin(), visibleOwners.end(), owner), visibleOwners.end());
+}
+
+void VisualiserWorkerPool::setOwnerVisible (const void* owner, bool shouldBeVisible)
+{
+    std::lock_guard<std::mutex> guard (lock);
+
+    visibleOwners.erase (std::remove (visibleOwners.begin(), visibleOwners.end(), owner), visibleOwners.end());
+    if (shouldBeVisible)
+        visibleOwners.push_back (owner);
+}
+
+void VisualiserWorkerPool::wakeUp (WakeableJob& job) noexcept
+{
+    // the request stays set until a worker consumed it under the lock, so it can't get lost
+    if (! job.wakeUpRequested.exchange (true))
+        condition.notify_one();
+}
+
+int VisualiserWorkerPool::getNumThreads() const
+{
+    return numThreads;
+}
+
+void VisualiserWorkerPool::waitUntilNotRunning (std::unique_lock<std::mutex>& guard, juce::TimeSliceClient* client)
+{
+    jobFinished.wait (guard, [this, client]
+    {
+        return std::none_of (jobs.begin(), jobs.end(), [client](const auto& j) { return j.client == client && j.running; });
+    });
+}
+
+bool VisualiserWorkerPool::isVisible (const void* owner) const
+{
+    return std::find (visibleOwners.begin(), visibleOwners.end(), owner) != visibleOwners.end();
+}
+
+VisualiserWorkerPool::Job* VisualiserWorkerPool::findNextJob (Clock::time_point now, Clock::time_point& nextDue)
+{
+    Job* best = nullptr;
+    bool bestIsVisible = false;
+
+    for (auto& job : jobs)
+    {
+        if (job.running || job.parked)
+            continue;
+
+        if (job.due > now)
+        {
+            nextDue = std::min (nextDue, job.due);
+            continue;
+        }
+
+        const auto visible = isVisible (job.owner);
+        if (best == nullptr || (visible && ! bestIsVisible) || (visible == bestIsVisible && job.due < best->due))
+        {
+            best = &job;
+            bestIsVisible = visible;
+        }
+    }
+
+    return best;
+}
+
+void VisualiserWorkerPool::runWorker()
+{
+    // a wakeUp() notification can get lost between checking and waiting, so idle
+    // workers check the wake up requests again after this time at the latest
+    const auto maxIdleTime = std::chrono::milliseconds (100);
+
+    std::unique_lock<std::mutex> guard (lock);
+
+    while (! shouldExit)
+    {
+        const auto now = Clock::now();
+
+        for (auto& job : jobs)
+        {
+            if (job.parked && job.wakeable->wakeUpRequested.exchange (false))
+            {
+                job.parked = false;
+                job.due = now;
+            }
+        }
+
+        auto nextDue = now + maxIdleTime;
+        auto* job = findNextJob (now, nextDue);
+
+        if (job == nullptr)
+        {
+            condition.wait_until (guard, nextDue);
+            continue;
+        }
+
+        auto* client = job->client;
+        job->running = true;
+
+        guard.unlock();
+        const auto msUntilNextCall = client->useTimeSlice();
+        guard.lock();
+
+        // the vector might have been reallocated while the lock was released
+        auto current = std::find_if (jobs.begin(), jobs.end(), [client](const auto& j) { return j.client == client; });
+        if (current != jobs.end())
+        {
+            current->running = false;
+
+            if (msUntilNextCall < 0)
+                jobs.erase (current);
+            else if (msUntilNextCall == parkUntilWokenUp && current->wakeable != nullptr)
+            {
+                // a wake up that arrived while the job was running means there is new data already
+                if (current->wakeable->wakeUpRequested.exchange (false))
+                    current->due = Clock::now();
+                else
+                    current->parked = true;
+            }
+            else if (msUntilNextCall == parkUntilWokenUp)
+            {
+                // only a WakeableJob can be parked, otherwise it would never be called again
+                jassertfalse;
+                current->due = Clock::now() + maxIdleTime;
+            }
+            else
+                current->due = Clock::now() + std::chrono::milliseconds (msUntilNextCall);
+        }
+
+        jobFinished.notify_all();
+    }
+}
+
+} // namespace foleys
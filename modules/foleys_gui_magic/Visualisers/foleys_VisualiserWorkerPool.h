@@ -0,0 +1,140 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace foleys
+{
+
+/**
+ The VisualiserWorkerPool runs the background jobs of the visualisers of all MagicGUIStates
+ in the process on a small, fixed number of threads. It is accessed via SharedVisualiserWorkerPool.
+
+ Jobs are juce::TimeSliceClients. The value returned from useTimeSlice() is the deadline for the
+ next call in milliseconds. Jobs are called earliest deadline first, jobs of owners that have a
+ visible editor are preferred. A WakeableJob can return parkUntilWokenUp, in which case it is only
+ called again after wakeUp() was called for it. Returning a negative value removes the job like in
+ a TimeSliceThread.
+ */
+class VisualiserWorkerPool
+{
+public:
+    static constexpr int parkUntilWokenUp = std::numeric_limits<int>::max();
+
+    /**
+     A job that can park itself until its producer has new data for it.
+     */
+    class WakeableJob : public juce::TimeSliceClient
+    {
+    public:
+        WakeableJob() = default;
+
+    private:
+        friend class VisualiserWorkerPool;
+        std::atomic<bool> wakeUpRequested { false };
+
+        JUCE_DECLARE_NON_COPYABLE (WakeableJob)
+    };
+
+    VisualiserWorkerPool();
+    ~VisualiserWorkerPool();
+
+    /**
+     Adds a job to the pool. The owner is used to give priority to visible editors.
+     */
+    void addJob (juce::TimeSliceClient* job, const void* owner);
+
+    /**
+     Removes a job. If the job is currently running, this waits until it returned.
+     */
+    void removeJob (juce::TimeSliceClient* job);
+
+    /**
+     Removes all jobs of an owner, waiting for running ones to return.
+     */
+    void removeJobsOf (const void* owner);
+
+    /**
+     Jobs of visible owners are called first, if several jobs are due.
+     */
+    void setOwnerVisible (const void* owner, bool isVisible);
+
+    /**
+     Reschedules the job if it is parked. If it is running at the moment, it is called again
+     instead of being parked. This doesn't lock, so it can be called from the audio thread.
+     */
+    void wakeUp (WakeableJob& job) noexcept;
+
+    int getNumThreads() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Job
+    {
+        juce::TimeSliceClient* client   = nullptr;
+        WakeableJob*           wakeable = nullptr;
+        const void*            owner    = nullptr;
+        Clock::time_point      due;
+        bool                   running  = false;
+        bool                   parked   = false;
+    };
+
+    void runWorker();
+    Job* findNextJob (Clock::time_point now, Clock::time_point& nextDue);
+    bool isVisible (const void* owner) const;
+    void waitUntilNotRunning (std::unique_lock<std::mutex>& guard, juce::TimeSliceClient* client);
+
+    const int numThreads;
+
+    std::mutex              lock;
+    std::condition_variable condition;
+    std::condition_variable jobFinished;
+
+    std::vector<Job>         jobs;
+    std::vector<const void*> visibleOwners;
+    std::vector<std::thread> threads;
+    bool                     shouldExit = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (VisualiserWorkerPool)
+};
+
+using SharedVisualiserWorkerPool = juce::SharedResourcePointer<VisualiserWorkerPool>;
+
+} // namespace foleys
@@ -35,6 +35,8 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
+#include "../Helpers/foleys_ImagePyramid.h"
+
 namespace foleys
 {
 
@@ -45,7 +47,10 @@ class AutoOrientationSlider  : public juce::Slider
 {
 public:
 
-    AutoOrientationSlider() = default;
+    AutoOrientationSlider()
+    {
+        filmStrip.onScaledImageReady = [this] { repaint(); };
+    }
 
     void setAutoOrientation (bool shouldAutoOrient)
     {
@@ -64,18 +69,8 @@ public:
             auto index = juce::roundToInt ((numImages - 1) * valueToProportionOfLength (getValue()));
             auto knobArea = getLookAndFeel().getSliderLayout(*this).sliderBounds;
 
-            if (horizontalFilmStrip)
-            {
-                auto w = filmStrip.getWidth() / numImages;
-                g.drawImage (filmStrip, knobArea.getX(), knobArea.getY(), knobArea.getWidth(), knobArea.getHeight(),
-                             index * w, 0, w, filmStrip.getHeight());
-            }
-            else
-            {
-                auto h = filmStrip.getHeight() / numImages;
-                g.drawImage (filmStrip, knobArea.getX(), knobArea.getY(), knobArea.getWidth(), knobArea.getHeight(),
-                             0, index * h, filmStrip.getWidth(), h);
-            }
+            // the frames are kept pre-scaled to the knob size, so this is a blit
+            filmStrip.drawFrame (g, index, knobArea.toFloat());
         }
     }
 
@@ -99,22 +94,25 @@ public:
 
     void setFilmStrip (juce::Image& image)
     {
-        filmStrip = image;
+        filmStripImage = image;
+        filmStrip.setImage (filmStripImage, numImages, horizontalFilmStrip);
     }
 
     void setNumImages (int num, bool horizontal)
     {
         numImages = num;
         horizontalFilmStrip = horizontal;
+        filmStrip.setImage (filmStripImage, numImages, horizontalFilmStrip);
     }
 
 private:
 
     bool autoOrientation = true;
 
-    juce::Image filmStrip;
-    int         numImages = 0;
-    bool        horizontalFilmStrip = false;
+    juce::Image  filmStripImage;
+    ImagePyramid filmStrip;
+    int          numImages = 0;
+    bool         horizontalFilmStrip = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AutoOrientationSlider)
 };
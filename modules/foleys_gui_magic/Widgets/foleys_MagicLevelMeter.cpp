@@ -55,9 +55,47 @@ void MagicLevelMeter::paint (juce::Graphics& g)
     actualLookAndFeel->drawLevelMeter (g, *this, source, getLocalBounds());
 }
 
+MagicLevelMeter::~MagicLevelMeter()
+{
+    if (consuming && source != nullptr)
+        source->removeConsumer();
+}
+
 void MagicLevelMeter::setLevelSource (MagicLevelSource* newSource)
 {
+    if (source == newSource)
+        return;
+
+    if (consuming && source != nullptr)
+        source->removeConsumer();
+
     source = newSource;
+
+    if (consuming && source != nullptr)
+        source->addConsumer();
+}
+
+void MagicLevelMeter::setConsumingSource (bool shouldConsume)
+{
+    if (consuming == shouldConsume)
+        return;
+
+    consuming = shouldConsume;
+
+    if (consuming)
+    {
+        if (source != nullptr)
+            source->addConsumer();
+
+        startTimerHz (30);
+    }
+    else
+    {
+        if (source != nullptr)
+            source->removeConsumer();
+
+        stopTimer();
+    }
 }
 
 void MagicLevelMeter::timerCallback()
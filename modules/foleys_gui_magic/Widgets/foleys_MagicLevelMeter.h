@@ -62,17 +62,25 @@ public:
     };
 
     MagicLevelMeter();
+    ~MagicLevelMeter() override;
 
     void paint (juce::Graphics& g) override;
 
     void setLevelSource (MagicLevelSource* newSource);
 
+    /**
+     While not consuming, the meter doesn't count as consumer of its source and stops
+     repainting. The MagicGUIBuilder turns this off while the GUI is cached without an editor.
+     */
+    void setConsumingSource (bool shouldConsume);
+
     void timerCallback() override;
 
     void lookAndFeelChanged() override;
 
 private:
     juce::WeakReference<MagicLevelSource> source;
+    bool                                  consuming = true;
 
     class LookAndFeelFallback : public LookAndFeel, public LookAndFeelMethods
     {
@@ -36,6 +36,33 @@
 namespace foleys
 {
 
+/**
+ Removes the plot from the OpenGL renderer while it or any of its parents is hidden,
+ since it isn't painted then to update or remove it.
+ */
+struct MagicPlotComponent::ShowingWatcher : public juce::ComponentMovementWatcher
+{
+    ShowingWatcher (MagicPlotComponent& plotToWatch)
+      : juce::ComponentMovementWatcher (&plotToWatch),
+        plot (plotToWatch)
+    {
+    }
+
+    using juce::ComponentMovementWatcher::componentMovedOrResized;
+    using juce::ComponentMovementWatcher::componentVisibilityChanged;
+
+    void componentMovedOrResized (bool, bool) override {}
+    void componentPeerChanged() override {}
+
+    void componentVisibilityChanged() override
+    {
+        if (! plot.isShowing())
+            plot.releaseOpenGL();
+    }
+
+    MagicPlotComponent& plot;
+};
+
 
 MagicPlotComponent::MagicPlotComponent()
 {
@@ -43,19 +70,93 @@ MagicPlotComponent::MagicPlotComponent()
     setColour (plotFillColourId, juce::Colours::orange.withAlpha (0.5f));
     setColour (plotInactiveColourId, juce::Colours::orange.darker());
     setColour (plotInactiveFillColourId, juce::Colours::orange.darker().withAlpha (0.5f));
+    setColour (plotBackgroundColourId, juce::Colours::transparentBlack);
 
     setOpaque (false);
     setPaintingIsUnclipped (true);
 }
 
+MagicPlotComponent::~MagicPlotComponent()
+{
+    showingWatcher.reset();
+    releaseOpenGL();
+
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    paintProfiler->removeComponent (this);
+#endif
+
+    pathTarget.reset();
+
+    if (consuming && plotSource != nullptr)
+        plotSource->removeConsumer();
+}
+
 void MagicPlotComponent::setPlotSource (MagicPlotSource* source)
 {
+    if (plotSource == source)
+        return;
+
+    pathTarget.reset();
+
+    if (consuming && plotSource != nullptr)
+        plotSource->removeConsumer();
+
     plotSource = source;
+
+    if (consuming && plotSource != nullptr)
+        plotSource->addConsumer();
+
+    updatePathBuilder();
+}
+
+void MagicPlotComponent::setPathBuilder (PlotPathBuilder* builder)
+{
+    if (pathBuilder == builder)
+        return;
+
+    pathBuilder = builder;
+    updatePathBuilder();
+
+    lastDataTimestamp = 0;
+    repaint();
+}
+
+void MagicPlotComponent::setConsumingSource (bool shouldConsume)
+{
+    if (consuming == shouldConsume)
+        return;
+
+    consuming = shouldConsume;
+
+    if (plotSource != nullptr)
+    {
+        if (consuming)
+            plotSource->addConsumer();
+        else
+            plotSource->removeConsumer();
+    }
+
+    updatePathBuilder();
+
+    lastDataTimestamp = 0;
+}
+
+void MagicPlotComponent::updatePathBuilder()
+{
+    pathTarget.reset();
+
+    // the builder of the previous source might still be set, while the source was changed already
+    if (consuming && pathBuilder != nullptr && plotSource != nullptr && &pathBuilder->getSource() == plotSource.get())
+        pathTarget = pathBuilder->createTarget (*this);
 }
 
 void MagicPlotComponent::setDecayFactor (float decayFactor)
 {
     decay = decayFactor;
+
+    // number of frames until a fully opaque pixel has faded out
+    numFadeFrames = decay > 0.0f ? getNumDecayFrames (decay) : 0;
+
     updateGlowBufferSize();
 }
 
@@ -72,27 +173,68 @@ void MagicPlotComponent::setGradientFromString (const juce::String& cssString, S
     }
 }
 
+void MagicPlotComponent::setUseOpenGL (bool shouldUseOpenGL)
+{
+    useOpenGL = shouldUseOpenGL;
+
+    if (useOpenGL && showingWatcher == nullptr)
+        showingWatcher = std::make_unique<ShowingWatcher> (*this);
+
+    if (! useOpenGL)
+    {
+        showingWatcher.reset();
+        releaseOpenGL();
+    }
+
+    repaint();
+}
+
 void MagicPlotComponent::paint (juce::Graphics& g)
 {
     if (plotSource == nullptr)
         return;
 
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    PaintProfiler::ScopedPaint measure (*paintProfiler, *this, g, "Plot");
+#endif
+
+    if (pathTarget != nullptr)
+    {
+        pathTarget->setSize (getLocalBounds().toFloat());
+
+        const auto generation = pathTarget->getGeneration();
+        glLineOutdated |= generation != lastPathGeneration;
+        lastPathGeneration = generation;
+
+        if (auto paths = pathTarget->getPaths())
+            drawPaths (g, paths->path, paths->filledPath);
+
+        return;
+    }
+
     const auto lastUpdate = plotSource->getLastDataUpdate();
     if (lastUpdate > lastDataTimestamp)
     {
         plotSource->createPlotPaths (path, filledPath, getLocalBounds().toFloat(), *this);
         lastDataTimestamp = lastUpdate;
+        glLineOutdated = true;
     }
 
+    drawPaths (g, path, filledPath);
+}
+
+void MagicPlotComponent::drawPaths (juce::Graphics& g, const juce::Path& pathToDraw, const juce::Path& filledPathToDraw)
+{
+    if (drawWithOpenGL (g, pathToDraw))
+        return;
+
     if (! glowBuffer.isNull())
-        drawPlotGlowing (g);
+        drawPlotGlowing (g, pathToDraw, filledPathToDraw);
     else
-    {
-        drawPlot (g);
-    }
+        drawPlot (g, pathToDraw, filledPathToDraw);
 }
 
-void MagicPlotComponent::drawPlot (juce::Graphics& g)
+void MagicPlotComponent::drawPlot (juce::Graphics& g, const juce::Path& pathToDraw, const juce::Path& filledPathToDraw)
 {
     const auto active = plotSource->isActive();
     auto colour = findColour (active ? plotFillColourId : plotInactiveFillColourId);
@@ -104,23 +246,32 @@ void MagicPlotComponent::drawPlot (juce::Graphics& g)
         gradient->setupGradientFill (g, getLocalBounds().toFloat());
 
     if (gradient || !colour.isTransparent())
-        g.fillPath (filledPath);
+        g.fillPath (filledPathToDraw);
 
     colour = findColour (active ? plotColourId : plotInactiveColourId);
     if (colour.isTransparent() == false)
     {
         g.setColour (colour);
-        g.strokePath (path, juce::PathStrokeType (2.0));
+        g.strokePath (pathToDraw, juce::PathStrokeType (2.0));
     }
 }
 
-void MagicPlotComponent::drawPlotGlowing (juce::Graphics& g)
+void MagicPlotComponent::drawPlotGlowing (juce::Graphics& g, const juce::Path& pathToDraw, const juce::Path& filledPathToDraw)
 {
-    if (decay < 1.0f)
-        glowBuffer.multiplyAllAlphas (decay);
+    if (decay < 1.0f && ! glowArea.isEmpty())
+    {
+        decayImage (glowBuffer, glowArea, decay);
+
+        if (--framesUntilFaded <= 0)
+            glowArea = {};
+    }
 
     juce::Graphics glow (glowBuffer);
-    drawPlot (glow);
+    drawPlot (glow, pathToDraw, filledPathToDraw);
+
+    // only the area that was painted in needs to fade out, the rest stays transparent
+    glowArea = glowArea.getUnion (filledPathToDraw.getBounds().getUnion (pathToDraw.getBounds()).getSmallestIntegerContainer().expanded (2));
+    framesUntilFaded = numFadeFrames;
 
     g.drawImageAt (glowBuffer, 0, 0);
 }
@@ -133,7 +284,10 @@ void MagicPlotComponent::updateGlowBufferSize()
     if (decay > 0.0f && w > 0 && h > 0)
     {
         if (glowBuffer.getWidth() != w || glowBuffer.getHeight() != h)
+        {
             glowBuffer = juce::Image (juce::Image::ARGB, w, h, true);
+            glowArea = {};
+        }
     }
     else
     {
@@ -141,9 +295,89 @@ void MagicPlotComponent::updateGlowBufferSize()
     }
 }
 
+void MagicPlotComponent::parentHierarchyChanged()
+{
+    // the renderer belongs to the editor, which can change when a cached GUI is attached again
+    releaseOpenGL();
+}
+
+bool MagicPlotComponent::drawWithOpenGL (juce::Graphics& g, const juce::Path& pathToDraw)
+{
+#if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
+    // the renderer can't show the parent underneath, so a transparent background is painted in software
+    const auto background = findColour (plotBackgroundColourId);
+    if (! useOpenGL || ! glowBuffer.isNull() || gradient || ! background.isOpaque())
+    {
+        releaseOpenGL();
+        return false;
+    }
+
+    auto* editor = findParentComponentOfClass<MagicPluginEditor>();
+    if (editor == nullptr || ! editor->getPlotRenderer().isAvailable())
+    {
+        releaseOpenGL();
+        return false;
+    }
+
+    glRenderer = &editor->getPlotRenderer();
+
+    const auto bounds = editor->getLocalArea (this, getLocalBounds());
+    const auto active = plotSource->isActive();
+    const auto stroke = findColour (active ? plotColourId : plotInactiveColourId);
+    const auto fill   = findColour (active ? plotFillColourId : plotInactiveFillColourId);
+
+    // the path is only flattened again if it changed, the renderer keeps the vertices meanwhile
+    if (glLineOutdated || bounds != glBounds || background != glBackground || stroke != glStroke || fill != glFill)
+    {
+        if (glLineOutdated)
+            glLine.setPath (pathToDraw);
+
+        glRenderer->setPlot (this, bounds, glLine, background, stroke, fill);
+
+        glLineOutdated = false;
+        glBounds       = bounds;
+        glBackground   = background;
+        glStroke       = stroke;
+        glFill         = fill;
+    }
+
+    // punch a hole, so the OpenGL output underneath the painted components shows through
+    g.setColour (juce::Colours::transparentBlack);
+    g.getInternalContext().fillRect (getLocalBounds(), true);
+    return true;
+#else
+    juce::ignoreUnused (g, pathToDraw);
+    return false;
+#endif
+}
+
+void MagicPlotComponent::releaseOpenGL()
+{
+#if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
+    // the editor owning the renderer might be gone already
+    if (auto* renderer = glRenderer.get())
+        renderer->removePlot (this);
+
+    glRenderer = nullptr;
+
+    // registering again needs the line, even if the path didn't change meanwhile
+    glLineOutdated = true;
+    glBounds = {};
+#endif
+}
+
 bool MagicPlotComponent::needsUpdate() const
 {
-    return plotSource ? (lastDataTimestamp < plotSource->getLastDataUpdate()) : false;
+    if (plotSource == nullptr)
+        return false;
+
+    if (pathTarget != nullptr)
+    {
+        pathTarget->checkForNewData();
+        return lastPathGeneration != pathTarget->getGeneration();
+    }
+
+    return lastDataTimestamp < plotSource->getLastDataUpdate();
 }
 
 void MagicPlotComponent::resized()
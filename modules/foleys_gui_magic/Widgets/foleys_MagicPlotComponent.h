@@ -35,9 +35,13 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
+#include "../Visualisers/foleys_PlotPathBuilder.h"
+
 namespace foleys
 {
 
+class MagicPlotGLRenderer;
+
 /**
  The MagicPlotComponent allows drawing the data from a MagicPlotSource.
  */
@@ -51,36 +55,89 @@ public:
         plotColourId = 0x2001000,
         plotInactiveColourId,
         plotFillColourId,
-        plotInactiveFillColourId
+        plotInactiveFillColourId,
+        plotBackgroundColourId
     };
 
     MagicPlotComponent();
+    ~MagicPlotComponent() override;
 
     void setPlotSource (MagicPlotSource* source);
     void setDecayFactor (float decayFactor);
     void setGradientFromString (const juce::String& cssString, Stylesheet& stylesheet);
 
+    /**
+     If a builder is set, the paths are created on the VisualiserWorkerPool for the size of this
+     component, and painting only strokes and fills them. The builder must be the one of the
+     plot source, see MagicGUIState::getPlotPathBuilder and PlotPathBuilder for the limitations.
+     */
+    void setPathBuilder (PlotPathBuilder* builder);
+
+    /**
+     While not consuming, the plot doesn't count as consumer of its source and no paths are built
+     in the background. The MagicGUIBuilder turns this off while the GUI is cached without an editor.
+     */
+    void setConsumingSource (bool shouldConsume);
+
+    /**
+     Draw the plot natively with OpenGL, if the editor has an OpenGLContext attached.
+     The plot area is filled with the plotBackgroundColourId, since JUCE composites
+     the painted components on top of the OpenGL output. This needs an opaque
+     plotBackgroundColourId, otherwise the plot is painted in software, so the parent
+     shows through. Plots with glow or gradient are always painted in software.
+     */
+    void setUseOpenGL (bool shouldUseOpenGL);
+
     void paint (juce::Graphics& g) override;
     void resized() override;
+    void parentHierarchyChanged() override;
 
     bool hitTest (int, int) override { return false; }
 
     bool needsUpdate() const;
 
 private:
-    void drawPlot (juce::Graphics& g);
-    void drawPlotGlowing (juce::Graphics& g);
+    void drawPaths (juce::Graphics& g, const juce::Path& pathToDraw, const juce::Path& filledPathToDraw);
+    void drawPlot (juce::Graphics& g, const juce::Path& pathToDraw, const juce::Path& filledPathToDraw);
+    void drawPlotGlowing (juce::Graphics& g, const juce::Path& pathToDraw, const juce::Path& filledPathToDraw);
     void updateGlowBufferSize();
+    bool drawWithOpenGL (juce::Graphics& g, const juce::Path& pathToDraw);
+    void releaseOpenGL();
+    void updatePathBuilder();
 
     juce::WeakReference<MagicPlotSource> plotSource;
     juce::Path                           path;
     juce::Path                           filledPath;
     std::unique_ptr<GradientBackground>  gradient;
+    PlotPathBuilder*                          pathBuilder = nullptr;
+    std::unique_ptr<PlotPathBuilder::Target>  pathTarget;
+    bool                                 consuming = true;
 
     juce::int64 lastDataTimestamp = 0;
+    int         lastPathGeneration = 0;
     juce::Image glowBuffer;
     float       decay = 0.0f;
 
+    // the area, where the glowBuffer is not yet completely faded out
+    juce::Rectangle<int> glowArea;
+    int                  framesUntilFaded = 0;
+    int                  numFadeFrames = 0;
+
+    // only used when drawing natively in OpenGL
+    struct ShowingWatcher;
+
+    bool                                     useOpenGL = false;
+    juce::WeakReference<MagicPlotGLRenderer> glRenderer;
+    std::unique_ptr<ShowingWatcher>          showingWatcher;
+    PlotLine                                 glLine;
+    bool                                     glLineOutdated = true;
+    juce::Rectangle<int>                     glBounds;
+    juce::Colour                             glBackground, glStroke, glFill;
+
+#if FOLEYS_ENABLE_PAINT_PROFILER
+    SharedPaintProfiler paintProfiler;
+#endif
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicPlotComponent)
 };
 
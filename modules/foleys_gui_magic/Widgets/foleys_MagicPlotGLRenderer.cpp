@@ -0,0 +1,245 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#include "foleys_MagicPlotGLRenderer.h"
+
+#if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
+
+namespace foleys
+{
+
+namespace
+{
+    // positions are in logical editor pixels, the vertex shader maps them to clip space
+    const char* plotVertexShader =
+        "attribute vec2 position;\n"
+        "uniform vec2 viewSize;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = vec4 (2.0 * position.x / viewSize.x - 1.0, 1.0 - 2.0 * position.y / viewSize.y, 0.0, 1.0);\n"
+        "}\n";
+
+    const char* plotFragmentShader =
+        "uniform " JUCE_MEDIUMP " vec4 colour;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = colour;\n"
+        "}\n";
+
+    constexpr float plotLineWidth = 2.0f;
+}
+
+juce::String MagicPlotGLRenderer::getShaderError() const
+{
+    const juce::ScopedLock lock (plotsLock);
+    return shaderError;
+}
+
+void MagicPlotGLRenderer::setViewSize (int width, int height)
+{
+    const juce::ScopedLock lock (plotsLock);
+    viewWidth  = width;
+    viewHeight = height;
+}
+
+void MagicPlotGLRenderer::setPlot (const juce::Component* plot, juce::Rectangle<int> bounds, const PlotLine& line,
+                                   juce::Colour background, juce::Colour stroke, juce::Colour fill)
+{
+    // the renderer can't composite with the painted parent, see the class description
+    jassert (background.isOpaque());
+
+    const juce::ScopedLock lock (plotsLock);
+    auto& vertices = plots [plot];
+
+    vertices.bounds     = bounds;
+    vertices.background = background;
+    vertices.stroke     = stroke;
+    vertices.fill       = fill;
+
+    vertices.strokeVertices.clear();
+    vertices.fillVertices.clear();
+
+    const auto offset = bounds.getPosition().toFloat();
+
+    if (! fill.isTransparent())
+        createPlotFillVertices (line, offset, float (bounds.getBottom()), vertices.fillVertices);
+
+    if (! stroke.isTransparent())
+        createPlotStrokeVertices (line, offset, plotLineWidth, vertices.strokeVertices);
+}
+
+bool MagicPlotGLRenderer::hasPlot (const juce::Component* plot) const
+{
+    const juce::ScopedLock lock (plotsLock);
+    return plots.find (plot) != plots.end();
+}
+
+void MagicPlotGLRenderer::removePlot (const juce::Component* plot)
+{
+    const juce::ScopedLock lock (plotsLock);
+    plots.erase (plot);
+}
+
+void MagicPlotGLRenderer::newOpenGLContextCreated()
+{
+    using namespace juce::gl;
+
+    auto* context = juce::OpenGLContext::getCurrentContext();
+    if (context == nullptr)
+        return;
+
+    auto program = std::make_unique<juce::OpenGLShaderProgram>(*context);
+    juce::String error;
+
+    if (program->addVertexShader (juce::OpenGLHelpers::translateVertexShaderToV3 (plotVertexShader)) &&
+        program->addFragmentShader (juce::OpenGLHelpers::translateFragmentShaderToV3 (plotFragmentShader)) &&
+        program->link())
+    {
+        viewSizeUniform   = std::make_unique<juce::OpenGLShaderProgram::Uniform>(*program, "viewSize");
+        colourUniform     = std::make_unique<juce::OpenGLShaderProgram::Uniform>(*program, "colour");
+        positionAttribute = glGetAttribLocation (program->getProgramID(), "position");
+
+        glGenBuffers (1, &vertexBuffer);
+
+        shader = std::move (program);
+
+        if (positionAttribute < 0)
+            error = "The position attribute was optimised away";
+    }
+    else
+    {
+        error = program->getLastError();
+    }
+
+    {
+        const juce::ScopedLock lock (plotsLock);
+        shaderError = error;
+    }
+
+    // if the shaders are not available, the plots are painted in software instead
+    available.store (error.isEmpty());
+}
+
+void MagicPlotGLRenderer::renderOpenGL()
+{
+    using namespace juce::gl;
+
+    // everything outside the plots is covered by the painted components
+    juce::OpenGLHelpers::clear (juce::Colours::black);
+
+    if (! available.load())
+        return;
+
+    int width  = 0;
+    int height = 0;
+
+    {
+        const juce::ScopedLock lock (plotsLock);
+        renderList.resize (plots.size());
+
+        size_t index = 0;
+        for (const auto& plot : plots)
+            renderList [index++] = plot.second;
+
+        width  = viewWidth;
+        height = viewHeight;
+    }
+
+    if (renderList.empty() || width <= 0 || height <= 0)
+        return;
+
+    auto* context = juce::OpenGLContext::getCurrentContext();
+    const auto scale  = context != nullptr ? context->getRenderingScale() : 1.0;
+
+    shader->use();
+    viewSizeUniform->set (float (width), float (height));
+
+    glEnable (GL_BLEND);
+    glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable (GL_SCISSOR_TEST);
+
+    glBindBuffer (GL_ARRAY_BUFFER, vertexBuffer);
+    glVertexAttribPointer (GLuint (positionAttribute), 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray (GLuint (positionAttribute));
+
+    for (const auto& plot : renderList)
+    {
+        const auto area = plot.bounds.toDouble() * scale;
+        glScissor (juce::roundToInt (area.getX()),
+                   juce::roundToInt (height * scale - area.getBottom()),
+                   juce::roundToInt (area.getWidth()),
+                   juce::roundToInt (area.getHeight()));
+
+        if (! plot.background.isTransparent())
+            juce::OpenGLHelpers::clear (plot.background);
+
+        drawVertices (plot.fillVertices, plot.fill, GL_TRIANGLE_STRIP);
+        drawVertices (plot.strokeVertices, plot.stroke, GL_TRIANGLES);
+    }
+
+    glDisableVertexAttribArray (GLuint (positionAttribute));
+    glBindBuffer (GL_ARRAY_BUFFER, 0);
+    glDisable (GL_SCISSOR_TEST);
+}
+
+void MagicPlotGLRenderer::drawVertices (const std::vector<float>& vertices, juce::Colour colour, juce::gl::GLenum mode)
+{
+    using namespace juce::gl;
+
+    if (vertices.empty() || colour.isTransparent())
+        return;
+
+    colourUniform->set (colour.getFloatRed(), colour.getFloatGreen(), colour.getFloatBlue(), colour.getFloatAlpha());
+
+    glBufferData (GL_ARRAY_BUFFER, GLsizeiptr (vertices.size() * sizeof (float)), vertices.data(), GL_STREAM_DRAW);
+    glDrawArrays (mode, 0, GLsizei (vertices.size() / 2));
+}
+
+void MagicPlotGLRenderer::openGLContextClosing()
+{
+    using namespace juce::gl;
+
+    available.store (false);
+
+    if (vertexBuffer != 0)
+        glDeleteBuffers (1, &vertexBuffer);
+
+    vertexBuffer = 0;
+    viewSizeUniform.reset();
+    colourUniform.reset();
+    shader.reset();
+}
+
+} // namespace foleys
+
+#endif // JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
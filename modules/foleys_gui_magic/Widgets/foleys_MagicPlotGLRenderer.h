@@ -0,0 +1,136 @@
+/*
+ ==============================================================================
+    Copyright (c) 2019-2023 Foleys Finest Audio - Daniel Walz
+    All rights reserved.
+
+    **BSD 3-Clause License**
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright notice, this
+       list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright notice,
+       this list of conditions and the following disclaimer in the documentation
+       and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holder nor the names of its contributors
+       may be used to endorse or promote products derived from this software without
+       specific prior written permission.
+
+ ==============================================================================
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+    DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+    OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+    OF THE POSSIBILITY OF SUCH DAMAGE.
+ ==============================================================================
+ */
+
+#pragma once
+
+#if JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
+
+namespace foleys
+{
+
+/**
+ The MagicPlotGLRenderer draws the MagicPlotComponents of an editor natively
+ with OpenGL. Each plot hands over its line as vertex array, which is uploaded
+ and drawn with a tiny shader instead of rasterising the paths on the CPU.
+
+ JUCE composites the painted components on top of the OpenGL output, so a plot
+ rendered here punches a transparent hole into its painted area and the renderer
+ fills that area with the plot's background colour before drawing. Whatever the
+ parent painted underneath is gone, that's why only plots with an opaque background
+ are drawn here.
+
+ If the shaders fail to compile (e.g. a minimal software GL implementation),
+ isAvailable() stays false and the plots are painted in software as before.
+ The reason can be read from getShaderError().
+ */
+class MagicPlotGLRenderer : public juce::OpenGLRenderer
+{
+public:
+    MagicPlotGLRenderer() = default;
+
+    /**
+     Returns true once the shaders are compiled and the renderer can draw plots.
+     */
+    bool isAvailable() const { return available.load(); }
+
+    /**
+     Returns the compiler or linker error, if the shaders couldn't be used.
+     */
+    juce::String getShaderError() const;
+
+    /**
+     The editor reports its size here, since the GL thread must not read it from the component.
+     */
+    void setViewSize (int width, int height);
+
+    /**
+     Set the vertices to draw for a plot.
+
+     @param plot        the component that owns the plot, used as key
+     @param bounds      the area of the plot in editor coordinates
+     @param line        the flattened plot line relative to the bounds
+     @param background  the colour to fill the plot area with, must be opaque
+     @param stroke      the colour of the line
+     @param fill        the colour of the area under the line
+     */
+    void setPlot (const juce::Component* plot, juce::Rectangle<int> bounds, const PlotLine& line,
+                  juce::Colour background, juce::Colour stroke, juce::Colour fill);
+
+    /**
+     Returns true if the plot is drawn by this renderer
+     */
+    bool hasPlot (const juce::Component* plot) const;
+
+    /**
+     Stop drawing a plot, e.g. when it is deleted or painted in software again
+     */
+    void removePlot (const juce::Component* plot);
+
+    void newOpenGLContextCreated() override;
+    void renderOpenGL() override;
+    void openGLContextClosing() override;
+
+private:
+    struct PlotVertices
+    {
+        juce::Rectangle<int> bounds;
+        juce::Colour         background;
+        juce::Colour         stroke;
+        juce::Colour         fill;
+        std::vector<float>   strokeVertices;
+        std::vector<float>   fillVertices;
+    };
+
+    void drawVertices (const std::vector<float>& vertices, juce::Colour colour, juce::gl::GLenum mode);
+
+    mutable juce::CriticalSection                  plotsLock;
+    std::map<const juce::Component*, PlotVertices> plots;
+    std::vector<PlotVertices>                      renderList;
+    int                                            viewWidth  = 0;
+    int                                            viewHeight = 0;
+    juce::String                                   shaderError;
+
+    std::unique_ptr<juce::OpenGLShaderProgram>          shader;
+    std::unique_ptr<juce::OpenGLShaderProgram::Uniform> viewSizeUniform;
+    std::unique_ptr<juce::OpenGLShaderProgram::Uniform> colourUniform;
+    juce::gl::GLuint                                    vertexBuffer = 0;
+    juce::gl::GLint                                     positionAttribute = -1;
+    std::atomic<bool>                                   available { false };
+
+    JUCE_DECLARE_WEAK_REFERENCEABLE (MagicPlotGLRenderer)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MagicPlotGLRenderer)
+};
+
+} // namespace foleys
+
+#endif // JUCE_MODULE_AVAILABLE_juce_opengl && FOLEYS_ENABLE_OPEN_GL_CONTEXT
@@ -45,8 +45,11 @@
 #include "General/foleys_MagicPluginEditor.cpp"
 #include "General/foleys_MagicProcessor.cpp"
 #include "General/foleys_Resources.cpp"
+#include "General/foleys_ImageAssetCache.cpp"
+#include "General/foleys_PaintProfiler.cpp"
 #include "General/foleys_MagicJUCEFactories.cpp"
 
+#include "State/foleys_PropertyBridge.cpp"
 #include "State/foleys_MagicGUIState.cpp"
 #include "State/foleys_MagicProcessorState.cpp"
 #include "State/foleys_ParameterManager.cpp"
@@ -55,13 +58,17 @@
 
 #include "Layout/foleys_GradientBackground.cpp"
 #include "Layout/foleys_Stylesheet.cpp"
+#include "Layout/foleys_ResolvedStyles.cpp"
 #include "Layout/foleys_Decorator.cpp"
 #include "Layout/foleys_Container.cpp"
 #include "Layout/foleys_GuiItem.cpp"
 #include "Layout/foleys_RootItem.cpp"
 
 #include "Helpers/foleys_DefaultGuiTrees.cpp"
+#include "Helpers/foleys_ImagePyramid.cpp"
 
+#include "Visualisers/foleys_VisualiserWorkerPool.cpp"
+#include "Visualisers/foleys_PlotPathBuilder.cpp"
 #include "Visualisers/foleys_MagicLevelSource.cpp"
 #include "Visualisers/foleys_MagicFilterPlot.cpp"
 #include "Visualisers/foleys_MagicAnalyser.cpp"
@@ -69,6 +76,7 @@
 
 #include "Widgets/foleys_MagicLevelMeter.cpp"
 #include "Widgets/foleys_MagicPlotComponent.cpp"
+#include "Widgets/foleys_MagicPlotGLRenderer.cpp"
 #include "Widgets/foleys_XYDragComponent.cpp"
 #include "Widgets/foleys_FileBrowserDialog.cpp"
 #include "Widgets/foleys_MidiLearnComponent.cpp"
@@ -77,6 +85,7 @@
 #include "LookAndFeels/foleys_JuceLookAndFeels.cpp"
 #include "LookAndFeels/foleys_LookAndFeel.cpp"
 #include "LookAndFeels/foleys_Skeuomorphic.cpp"
+#include "LookAndFeels/foleys_LookAndFeelRegistry.cpp"
 
 #if FOLEYS_SHOW_GUI_EDITOR_PALLETTE
 
@@ -94,6 +103,7 @@ namespace EditorColours
 #include "Editor/foleys_GUITreeEditor.cpp"
 #include "Editor/foleys_PropertiesEditor.cpp"
 #include "Editor/foleys_Palette.cpp"
+#include "Editor/foleys_PaintProfilerPanel.cpp"
 
 #include "Editor/foleys_MultiListPropertyComponent.cpp"
 #include "Editor/foleys_StylePropertyComponent.cpp"
@@ -58,6 +58,14 @@
 #define FOLEYS_SHOW_GUI_EDITOR_PALLETTE 1
 #endif
 
+/** Config: FOLEYS_ENABLE_PAINT_PROFILER
+            Measures paint time, repaint count and invalidated area of each GuiItem and plot.
+            The results are shown in the ToolBox and as heatmap over the editor. Set this to 0 in a release build.
+  */
+#ifndef FOLEYS_ENABLE_PAINT_PROFILER
+#define FOLEYS_ENABLE_PAINT_PROFILER 0
+#endif
+
 /** Config: FOLEYS_ENABLE_BINARY_DATA
             Makes the binary resources available to the GUI. Make sure you actually have
             at least one file added, or this will fail to compile.
@@ -96,18 +104,26 @@
 #include "General/foleys_ApplicationSettings.h"
 #include "General/foleys_SettableProperties.h"
 #include "General/foleys_Resources.h"
+#include "General/foleys_ImageAssetCache.h"
+#include "General/foleys_PaintProfiler.h"
 
 #include "Helpers/foleys_ScopedInterProcessLock.h"
 #include "Helpers/foleys_PopupMenuHelper.h"
 #include "Helpers/foleys_MouseLambdas.h"
 #include "Helpers/foleys_ParameterAttachment.h"
 #include "Helpers/foleys_AtomicValueAttachment.h"
+#include "Helpers/foleys_SeqLock.h"
 #include "Helpers/foleys_Conversions.h"
+#include "Helpers/foleys_ImagePyramid.h"
+#include "Helpers/foleys_ImageDecay.h"
+#include "Helpers/foleys_PlotVertices.h"
+#include "Helpers/foleys_LayerCache.h"
 #include "Helpers/foleys_DefaultGuiTrees.h"
 
 #include "Layout/foleys_GradientBackground.h"
 #include "Layout/foleys_BoxModel.h"
 #include "Layout/foleys_Stylesheet.h"
+#include "Layout/foleys_ResolvedStyles.h"
 #include "Layout/foleys_Decorator.h"
 #include "Layout/foleys_GuiItem.h"
 #include "Layout/foleys_Container.h"
@@ -116,9 +132,13 @@
 #include "LookAndFeels/foleys_JuceLookAndFeels.h"
 #include "LookAndFeels/foleys_LookAndFeel.h"
 #include "LookAndFeels/foleys_Skeuomorphic.h"
+#include "LookAndFeels/foleys_LookAndFeelRegistry.h"
 
 #include "Visualisers/foleys_MagicLevelSource.h"
+#include "Visualisers/foleys_PlotGeometry.h"
+#include "Visualisers/foleys_PlotPathBuilder.h"
 #include "Visualisers/foleys_MagicPlotSource.h"
+#include "Visualisers/foleys_VisualiserWorkerPool.h"
 #include "Visualisers/foleys_MagicFilterPlot.h"
 #include "Visualisers/foleys_MagicAnalyser.h"
 #include "Visualisers/foleys_MagicOscilloscope.h"
@@ -126,6 +146,7 @@
 #include "Widgets/foleys_AutoOrientationSlider.h"
 #include "Widgets/foleys_MagicLevelMeter.h"
 #include "Widgets/foleys_MagicPlotComponent.h"
+#include "Widgets/foleys_MagicPlotGLRenderer.h"
 #include "Widgets/foleys_XYDragComponent.h"
 #include "Widgets/foleys_FileBrowserDialog.h"
 #include "Widgets/foleys_MidiLearnComponent.h"
@@ -134,6 +155,7 @@
 #include "State/foleys_RadioButtonManager.h"
 #include "State/foleys_ParameterManager.h"
 #include "State/foleys_MidiParameterMapper.h"
+#include "State/foleys_PropertyBridge.h"
 #include "State/foleys_MagicGUIState.h"
 #include "State/foleys_MagicProcessorState.h"
 